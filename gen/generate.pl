@@ -34,11 +34,13 @@ my $N = 0x110000;
 my %cat = (name=>'CATEGORY', data=>[('_Cn') x $N]);
 my %othercase = (name=>'OTHERCASE', data=>[(0) x $N]);
 my %ccc = (name=>'CCC', data=>[(0) x $N]);
-my %composition = (name=>'COMPOSITION', data=>[], composition=>[], rawdata=>[0]);
+my %composition = (name=>'COMPOSITION', composition=>[]);
 my %decomposition = (name=>'DECOMPOSITION', data=>[], decomposition=>[], rawdata=>[0]);
+my %kompatibility_decomposition = (name=>'KOMPATIBILITY_DECOMPOSITION', data=>[], rawdata=>[0]);
 my %combining_mark = (name=>'COMBINING_MARK', data=>[(0) x $N]);
 my %stripped = (name=>'STRIPPED', data=>[(0) x $N], rawdata=>[0], rawmap=>{});
-my @data = (\%cat, \%othercase, \%ccc, \%composition, \%decomposition, \%combining_mark, \%stripped);
+my %quick_check = (name=>'QUICK_CHECK', data=>[(0) x $N]);
+my @data = (\%cat, \%othercase, \%ccc, \%decomposition, \%kompatibility_decomposition, \%combining_mark, \%stripped, \%quick_check);
 
 open (my $f, "<", "$UnicodeDataDir/UnicodeData.txt") or die "Cannot open '$UnicodeDataDir/UnicodeData.txt': $!";
 while (<$f>) {
@@ -107,13 +109,53 @@ for (my $code = 0; $code < $N; $code++) {
   push @{$composition{composition}->[$decomposition{decomposition}->[$code]->[1]]}, [$decomposition{decomposition}->[$code]->[2], $code];
 }
 
-for (my $code = 0; $code <= $N; $code++) {
-  my @composition;
-  @composition = sort {$a->[0] <=> $b->[0]} @{$composition{composition}->[$code]} if $composition{composition}->[$code];
-  $composition{data}->[$code] = scalar(@{$composition{rawdata}});
-  push @{$composition{rawdata}}, map {@{$_}} @composition;
+# Fill composition data, which is a perfect hash of the (starter, second)
+# pairs computed the same way as in uninorms::composition. The pairs are
+# distributed into buckets using their hash, and for every bucket (starting
+# with the largest ones), a seed placing all its pairs into distinct free
+# slots is found. A slot contains the starter, the second character, and the
+# composite, 21 bits each.
+sub composition_hash {
+  my ($starter, $second) = @_;
+  return (($starter * 0x9E3779B1) ^ ($second * 0x85EBCA77)) & 0xFFFFFFFF;
 }
-$composition{rawdata} = "{\n  " . join(",", @{$composition{rawdata}}) . "\n}";
+sub composition_slot {
+  my ($hash, $seed) = @_;
+  return ((($hash ^ $seed) * 0xC2B2AE3D) & 0xFFFFFFFF) >> (32 - $composition{slot_bits});
+}
+
+my @compositions = ();
+for (my $code = 0; $code < $N; $code++) {
+  push @compositions, map {[$code, @{$_}]} @{$composition{composition}->[$code] || []};
+}
+$composition{slot_bits} = 1;
+$composition{slot_bits}++ while (1 << $composition{slot_bits}) < 2 * @compositions;
+$composition{bucket_bits} = $composition{slot_bits} - 2;
+
+my @composition_buckets = map {[]} 1 .. 1 << $composition{bucket_bits};
+push @{$composition_buckets[composition_hash($_->[0], $_->[1]) >> (32 - $composition{bucket_bits})]}, $_ foreach @compositions;
+my @composition_seeds = (0) x (1 << $composition{bucket_bits});
+my @composition_table = (0) x (1 << $composition{slot_bits});
+foreach my $bucket (sort {@{$composition_buckets[$b]} <=> @{$composition_buckets[$a]} || $a <=> $b} 0 .. $#composition_buckets) {
+  next unless @{$composition_buckets[$bucket]};
+  my $seed = 0;
+  SEED: for (; $seed < 0x10000; $seed++) {
+    my %slots = ();
+    foreach my $composition (@{$composition_buckets[$bucket]}) {
+      my $slot = composition_slot(composition_hash($composition->[0], $composition->[1]), $seed);
+      next SEED if $composition_table[$slot] || $slots{$slot}++;
+    }
+    last;
+  }
+  die "Cannot find a seed for composition bucket $bucket" if $seed == 0x10000;
+  $composition_seeds[$bucket] = $seed;
+  foreach my $composition (@{$composition_buckets[$bucket]}) {
+    $composition_table[composition_slot(composition_hash($composition->[0], $composition->[1]), $seed)] =
+      ($composition->[0] << 42) | ($composition->[1] << 21) | $composition->[2];
+  }
+}
+$composition{seeds} = "{\n  " . join(",", @composition_seeds) . "\n}";
+$composition{table} = "{\n  " . join(",", map {$_ ? sprintf("0x%XULL", $_) : 0} @composition_table) . "\n}";
 
 # Fill decomposition data
 sub skip_first {
@@ -127,19 +169,73 @@ sub decompose {
   return map {decompose($_, $kompatibility)} skip_first(@{$decomposition{decomposition}->[$code]});
 }
 
-for (my $code = 0; $code <= $N; $code++) {
-  my ($kompatibility, $further_kompatibility, @decomposition) = (0, 0);
-  if ($decomposition{decomposition}->[$code]) {
-    $kompatibility = $decomposition{decomposition}->[$code]->[0];
-    @decomposition = map {decompose($_, $kompatibility)} skip_first(@{$decomposition{decomposition}->[$code]});
-    $further_kompatibility = join(" ",@decomposition) ne join(" ",map {decompose($_, 1)} skip_first(@{$decomposition{decomposition}->[$code]})) ? 1 : 0;
-    die "No decomposition" if not @decomposition;
-    die "Identity decomposition" if @decomposition == 1 && $decomposition[0] eq $code;
+# The canonical and kompatibility data contain the full recursive
+# decompositions (empty for characters without a decomposition), and whether
+# the decomposition (or the character itself) contains a combining mark.
+foreach my $data_ref (\%decomposition, \%kompatibility_decomposition) {
+  my $kompatibility = $data_ref == \%kompatibility_decomposition ? 1 : 0;
+  for (my $code = 0; $code <= $N; $code++) {
+    my @decomposition;
+    if ($code < $N && $decomposition{decomposition}->[$code] && ($kompatibility || !$decomposition{decomposition}->[$code]->[0])) {
+      @decomposition = decompose($code, $kompatibility);
+      die "No decomposition" if not @decomposition;
+      die "Identity decomposition" if @decomposition == 1 && $decomposition[0] eq $code;
+    }
+    my $mark = $code < $N && grep {$ccc{data}->[$_]} (@decomposition ? @decomposition : $code);
+    $data_ref->{data}->[$code] = 2 * scalar(@{$data_ref->{rawdata}}) + ($mark ? 1 : 0);
+    push @{$data_ref->{rawdata}}, @decomposition;
+  }
+  die "Too much $data_ref->{name} data" if 2 * @{$data_ref->{rawdata}} >= 0x10000;
+  $data_ref->{rawdata} = "{\n  " . join(",", @{$data_ref->{rawdata}}) . "\n}";
+}
+
+# Load the NFC_QC, NFD_QC, NFKC_QC, and NFKD_QC properties of
+# DerivedNormalizationProps and fill quick check data. Every code point has
+# two bits for each of NFC, NFD, NFKC, NFKD (in this order), with values
+# 0 for Yes (the default), 1 for No, and 2 for Maybe.
+my %quick_check_forms = (NFC_QC=>0, NFD_QC=>1, NFKC_QC=>2, NFKD_QC=>3);
+open ($f, "<", "$UnicodeDataDir/DerivedNormalizationProps.txt") or die "Cannot open '$UnicodeDataDir/DerivedNormalizationProps.txt': $!";
+while (<$f>) {
+  chomp;
+  s/\s*(#.*)?$//;
+  next unless length;
+  my ($range, $property, $value) = split /\s*;\s*/;
+  next unless defined $property && exists $quick_check_forms{$property};
+  my ($first, $last) = $range =~ /^([\da-fA-F]{4,6})(?:\.\.([\da-fA-F]{4,6}))?$/ or die "Bad line $_ in DerivedNormalizationProps";
+  defined $value && $value =~ /^[NM]$/ or die "Bad line $_ in DerivedNormalizationProps";
+  for (my $code = hex($first); $code <= hex($last // $first); $code++) {
+    $quick_check{data}->[$code] |= ($value eq "N" ? 1 : 2) << (2 * $quick_check_forms{$property});
+  }
+}
+close $f;
+
+# Check the quick check data against the derivation described in UAX #15,
+# so that the properties stay consistent with the decompositions and
+# compositions used by the normalization.
+my %composition_second = ();
+for (my $code = 0; $code < $N; $code++) {
+  $composition_second{$_->[0]} = 1 foreach @{$composition{composition}->[$code] || []};
+}
+for (my $code = 0; $code < $N; $code++) {
+  my ($nfc, $nfd, $nfkc, $nfkd) = (0, 0, 0, 0);
+  my $hangul = $code >= 0xAC00 && $code < 0xAC00 + 11172;
+  if ($hangul || ($decomposition{decomposition}->[$code] && !$decomposition{decomposition}->[$code]->[0])) {
+    $nfd = $nfkd = 1;
+    # Full composition exclusions are exclusions, singletons, and non-starter decompositions.
+    my @decomposition = @{$decomposition{decomposition}->[$code] || [0, 0, 0]};
+    $nfc = $nfkc = 1 if !$hangul && ($excluded{$code} || @decomposition == 2 || $ccc{data}->[$code] || $ccc{data}->[$decomposition[1]]);
+  }
+  if ($decomposition{decomposition}->[$code] && join(" ", decompose($code, 1)) ne join(" ", decompose($code, 0))) {
+    $nfkd = $nfkc = 1;
   }
-  $decomposition{data}->[$code] = 4 * scalar(@{$decomposition{rawdata}}) + 2 * $further_kompatibility + $kompatibility;
-  push @{$decomposition{rawdata}}, @decomposition;
+  # Code points whose decomposition starts with a second character of a composition can compose with a previous one.
+  my $first = (decompose($code, 0))[0];
+  my $second = $composition_second{$first} || ($first >= 0x1161 && $first < 0x1161 + 21) || ($first > 0x11A7 && $first < 0x11A7 + 28);
+  $nfc = 2 if $second && !$nfc;
+  $nfkc = 2 if $second && !$nfkc;
+  die sprintf("Quick check of %04X in DerivedNormalizationProps differs from the derived one", $code)
+    if $quick_check{data}->[$code] != $nfc + 4 * $nfd + 16 * $nfkc + 64 * $nfkd;
 }
-$decomposition{rawdata} = "{\n  " . join(",", @{$decomposition{rawdata}}) . "\n}";
 
 # Fill combining mark data
 for (my $code = 0; $code < $N; $code++) {
@@ -167,10 +263,10 @@ $stripped{rawdata} = "{\n  " . join(",", @{$stripped{rawdata}}) . "\n}";
 # Generate blocks of suitable length (32, 256 or 257).
 foreach my $data_ref (@data) {
   my (@blocks, %blocks, @indices);
-  my $bsize = $data_ref->{name} =~ /(DE)?COMPOSITION/ ? 257 : 256;
+  my $bsize = $data_ref->{name} =~ /DECOMPOSITION/ ? 257 : 256;
   for (my $b = 0; $b < $N; $b += 256) {
     my $block = "{" . join(",",
-      $data_ref->{name} =~ /(DE)?COMPOSITION/ ? $data_ref->{data}->[$b]==$data_ref->{data}->[$b+256] ? (0)x257 : @{$data_ref->{data}}[$b..$b+256] :
+      $data_ref->{name} =~ /DECOMPOSITION/ ? $data_ref->{data}->[$b]>>1==$data_ref->{data}->[$b+256]>>1 ? map {$_ & 1} @{$data_ref->{data}}[$b..$b+256] : @{$data_ref->{data}}[$b..$b+256] :
       $data_ref->{name} =~ /COMBINING_MARK/ ? map(ord, split(//, pack("b*", join("", @{$data_ref->{data}}[$b..$b+255])))) :
       @{$data_ref->{data}}[$b..$b+255]
     ) . "}";
@@ -204,9 +300,11 @@ foreach my $data_ref (@data) {
   $data_ref->{indices} = split_long($data_ref->{indices});
   $data_ref->{blocks} = split_long($data_ref->{blocks});
 }
-foreach my $data_ref (\%composition, \%decomposition, \%stripped) {
+foreach my $data_ref (\%decomposition, \%kompatibility_decomposition, \%stripped) {
   $data_ref->{rawdata} = split_long($data_ref->{rawdata});
 }
+$composition{seeds} = split_long($composition{seeds});
+$composition{table} = split_long($composition{table});
 
 # Generate code for performing full casing mappings.
 my %full_casings = ();
@@ -244,9 +342,10 @@ while (@ARGV) {
       s/\$$data_ref->{name}_INDICES/$data_ref->{indices}/eg;
       s/\$$data_ref->{name}_BLOCKS/$data_ref->{blocks}/eg;
     }
-    foreach my $data_ref (\%composition, \%decomposition, \%stripped) {
+    foreach my $data_ref (\%decomposition, \%kompatibility_decomposition, \%stripped) {
       s/\$$data_ref->{name}_DATA/$data_ref->{rawdata}/eg;
     }
+    s/\$COMPOSITION_(SLOT_BITS|BUCKET_BITS|SEEDS|TABLE)/$composition{lc $1}/eg;
     foreach my $casing (keys %full_casings) {
       s/\$${casing}CASES_FULL/$full_casings{$casing}/eg;
     }
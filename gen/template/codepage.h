@@ -0,0 +1,370 @@
+// This file is part of UniLib <http://github.com/ufal/unilib/>.
+//
+// Copyright 2014-2024 Institute of Formal and Applied Linguistics, Faculty
+// of Mathematics and Physics, Charles University in Prague, Czech Republic.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// UniLib version: $UNILIB_VERSION
+// Unicode version: $UNICODE_VERSION
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "utf.h"
+
+namespace unilib {
+
+// The `codepage` class converts between the single-byte ASCII, ISO-8859-1
+// (Latin-1), and Windows-1252 encodings and the UTF-8, UTF-16, and UTF-32
+// encodings of the `utf` class. The Windows-1252 bytes 0x81, 0x8D, 0x8F,
+// 0x90, and 0x9D, which are undefined in it, are mapped to the C1 control
+// characters of the same value, as in Latin-1. Bytes above 0x7F in ASCII are
+// decoded as '?', and code points not in an encoding are encoded as '?'.
+class codepage {
+ public:
+  enum encoding_t { ASCII, LATIN1, CP1252 };
+
+  // Decoding and encoding a single character; `encode` returns false if the
+  // code point is not in the encoding
+  inline static char32_t decode(encoding_t encoding, char chr);
+  inline static bool encode(encoding_t encoding, char32_t chr, char& encoded);
+
+  // Decoding of a whole string into an exactly presized UTF-8, UTF-16, or
+  // UTF-32 string
+  inline static void decode(encoding_t encoding, std::string_view str, std::string& decoded);
+  inline static void decode(encoding_t encoding, std::string_view str, std::u16string& decoded);
+  inline static void decode(encoding_t encoding, std::string_view str, std::u32string& decoded);
+
+  // Length of a whole string decoded into UTF-8
+  inline static size_t utf8_length(encoding_t encoding, std::string_view str);
+
+  // Whether a UTF-8, UTF-16, or UTF-32 string is valid and all its code
+  // points are in the encoding
+  inline static bool fits(encoding_t encoding, std::string_view str);
+  inline static bool fits(encoding_t encoding, std::u16string_view str);
+  inline static bool fits(encoding_t encoding, std::u32string_view str);
+
+  // Encoding of a whole UTF-8, UTF-16, or UTF-32 string into an exactly
+  // presized string; returns false if the string does not fit the encoding
+  inline static bool encode(encoding_t encoding, std::string_view str, std::string& encoded);
+  inline static bool encode(encoding_t encoding, std::u16string_view str, std::string& encoded);
+  inline static bool encode(encoding_t encoding, std::u32string_view str, std::string& encoded);
+
+ private:
+  inline static const char REPLACEMENT_CHAR = '?';
+
+  // Code points of the Windows-1252 bytes 0x80-0x9F
+  inline static const char16_t cp1252_controls[32] = {
+    0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+    0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178,
+  };
+
+  // The SIMD kernels process a prefix of whole blocks of 16 characters which
+  // are the same in the encoding and in Unicode: the ASCII kernels copy
+  // ASCII blocks between the encoding and UTF-8, the others widen or narrow
+  // blocks of ASCII, Latin-1, or Windows-1252 characters outside of 0x80-0x9F.
+#ifdef UNILIB_UTF_SSE2
+  inline static size_t ascii_sse2(std::string_view str, char* copied);
+  inline static size_t utf8_length_sse2(encoding_t encoding, std::string_view str, size_t& length);
+  inline static size_t decode_sse2(encoding_t encoding, std::string_view str, char16_t* decoded);
+  inline static size_t decode_sse2(encoding_t encoding, std::string_view str, char32_t* decoded);
+  inline static size_t encode_sse2(encoding_t encoding, std::u16string_view str, char* encoded);
+  inline static size_t encode_sse2(encoding_t encoding, std::u32string_view str, char* encoded);
+#endif
+  inline static size_t ascii_simd(std::string_view str, char* copied);
+  inline static size_t utf8_length_simd(encoding_t encoding, std::string_view str, size_t& length);
+  template<class Char> inline static size_t decode_simd(encoding_t encoding, std::string_view str, Char* decoded);
+  template<class Char> inline static size_t encode_simd(encoding_t encoding, std::basic_string_view<Char> str, char* encoded);
+};
+
+// Definitions
+char32_t codepage::decode(encoding_t encoding, char chr) {
+  unsigned char byte = chr;
+  if (byte < 0x80) return byte;
+  if (encoding == ASCII) return REPLACEMENT_CHAR;
+  if (encoding == CP1252 && byte < 0xA0) return cp1252_controls[byte - 0x80];
+  return byte;
+}
+
+bool codepage::encode(encoding_t encoding, char32_t chr, char& encoded) {
+  if (chr < 0x80 || (encoding == LATIN1 && chr < 0x100) || (encoding == CP1252 && chr >= 0xA0 && chr < 0x100)) {
+    encoded = chr;
+    return true;
+  }
+  if (encoding == CP1252)
+    for (unsigned i = 0; i < 32; i++)
+      if (cp1252_controls[i] == chr) {
+        encoded = 0x80 + i;
+        return true;
+      }
+  encoded = REPLACEMENT_CHAR;
+  return false;
+}
+
+// Decoding of a whole string
+void codepage::decode(encoding_t encoding, std::string_view str, std::string& decoded) {
+  decoded.resize(utf8_length(encoding, str));
+  char* output = decoded.data();
+  while (!str.empty()) {
+    // Copy ASCII blocks, then decode the following block character by character.
+    size_t ascii = ascii_simd(str, output);
+    output += ascii;
+    str.remove_prefix(ascii);
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; str.remove_prefix(1))
+      utf::append(output, decode(encoding, str.front()));
+  }
+}
+
+void codepage::decode(encoding_t encoding, std::string_view str, std::u16string& decoded) {
+  decoded.resize(str.size());
+  char16_t* output = decoded.data();
+  while (!str.empty()) {
+    // Widen blocks of characters mapped to themselves, then decode the
+    // following block character by character.
+    size_t widened = decode_simd(encoding, str, output);
+    output += widened;
+    str.remove_prefix(widened);
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; str.remove_prefix(1))
+      *output++ = decode(encoding, str.front());
+  }
+}
+
+void codepage::decode(encoding_t encoding, std::string_view str, std::u32string& decoded) {
+  decoded.resize(str.size());
+  char32_t* output = decoded.data();
+  while (!str.empty()) {
+    // Widen blocks of characters mapped to themselves, then decode the
+    // following block character by character.
+    size_t widened = decode_simd(encoding, str, output);
+    output += widened;
+    str.remove_prefix(widened);
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; str.remove_prefix(1))
+      *output++ = decode(encoding, str.front());
+  }
+}
+
+// Length of a whole string decoded into UTF-8
+size_t codepage::utf8_length(encoding_t encoding, std::string_view str) {
+  size_t length = 0;
+  while (!str.empty()) {
+    size_t processed = utf8_length_simd(encoding, str, length);
+    str.remove_prefix(processed);
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; str.remove_prefix(1)) {
+      char32_t chr = decode(encoding, str.front());
+      length += chr < 0x80 ? 1 : chr < 0x800 ? 2 : 3;
+    }
+  }
+  return length;
+}
+
+// Whether a whole string fits the encoding
+bool codepage::fits(encoding_t encoding, std::string_view str) {
+  utf::profile_t profile = utf::analyze(str);
+  if (!profile.valid) return false;
+  if (profile.max_code_point < 0x80 || (encoding == LATIN1 && profile.max_code_point < 0x100)) return true;
+  if (encoding != CP1252) return false;
+  while (!str.empty())
+    if (char encoded; !encode(encoding, utf::decode(str), encoded)) return false;
+  return true;
+}
+
+bool codepage::fits(encoding_t encoding, std::u16string_view str) {
+  utf::profile_t profile = utf::analyze(str);
+  if (!profile.valid) return false;
+  if (profile.max_code_point < 0x80 || (encoding == LATIN1 && profile.max_code_point < 0x100)) return true;
+  if (encoding != CP1252) return false;
+  while (!str.empty())
+    if (char encoded; !encode(encoding, utf::decode(str), encoded)) return false;
+  return true;
+}
+
+bool codepage::fits(encoding_t encoding, std::u32string_view str) {
+  for (auto&& chr : str)
+    if (char encoded; !encode(encoding, chr, encoded)) return false;
+  return true;
+}
+
+// Encoding of a whole string
+bool codepage::encode(encoding_t encoding, std::string_view str, std::string& encoded) {
+  // Every code point, including the invalid sequences, is encoded as one byte.
+  utf::profile_t profile = utf::analyze(str);
+  bool valid = profile.valid;
+  encoded.resize(profile.utf32_length);
+  char* output = encoded.data();
+  while (!str.empty()) {
+    // Copy ASCII blocks, then encode the following block code point by code point.
+    size_t ascii = ascii_simd(str, output);
+    output += ascii;
+    str.remove_prefix(ascii);
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; )
+      valid &= encode(encoding, utf::decode(str), *output++);
+  }
+  return valid;
+}
+
+bool codepage::encode(encoding_t encoding, std::u16string_view str, std::string& encoded) {
+  // Every code point, including the lone surrogates, is encoded as one byte.
+  bool valid = utf::valid(str);
+  encoded.resize(utf::utf32_length(str));
+  char* output = encoded.data();
+  while (!str.empty()) {
+    // Narrow blocks of characters mapped to themselves, then encode the
+    // following block code point by code point.
+    size_t narrowed = encode_simd(encoding, str, output);
+    output += narrowed;
+    str.remove_prefix(narrowed);
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; )
+      valid &= encode(encoding, utf::decode(str), *output++);
+  }
+  return valid;
+}
+
+bool codepage::encode(encoding_t encoding, std::u32string_view str, std::string& encoded) {
+  bool valid = true;
+  encoded.resize(str.size());
+  char* output = encoded.data();
+  while (!str.empty()) {
+    // Narrow blocks of characters mapped to themselves, then encode the
+    // following block code point by code point.
+    size_t narrowed = encode_simd(encoding, str, output);
+    output += narrowed;
+    str.remove_prefix(narrowed);
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; str.remove_prefix(1))
+      valid &= encode(encoding, str.front(), *output++);
+  }
+  return valid;
+}
+
+// SIMD kernels
+size_t codepage::ascii_simd([[maybe_unused]] std::string_view str, [[maybe_unused]] char* copied) {
+#ifdef UNILIB_UTF_SSE2
+  return ascii_sse2(str, copied);
+#else
+  return 0;
+#endif
+}
+
+size_t codepage::utf8_length_simd([[maybe_unused]] encoding_t encoding, [[maybe_unused]] std::string_view str, [[maybe_unused]] size_t& length) {
+#ifdef UNILIB_UTF_SSE2
+  return utf8_length_sse2(encoding, str, length);
+#else
+  return 0;
+#endif
+}
+
+template<class Char>
+size_t codepage::decode_simd([[maybe_unused]] encoding_t encoding, [[maybe_unused]] std::string_view str, [[maybe_unused]] Char* decoded) {
+#ifdef UNILIB_UTF_SSE2
+  return decode_sse2(encoding, str, decoded);
+#else
+  return 0;
+#endif
+}
+
+template<class Char>
+size_t codepage::encode_simd([[maybe_unused]] encoding_t encoding, [[maybe_unused]] std::basic_string_view<Char> str, [[maybe_unused]] char* encoded) {
+#ifdef UNILIB_UTF_SSE2
+  return encode_sse2(encoding, str, encoded);
+#else
+  return 0;
+#endif
+}
+
+#ifdef UNILIB_UTF_SSE2
+size_t codepage::ascii_sse2(std::string_view str, char* copied) {
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i*)(str.data() + i));
+    if (_mm_movemask_epi8(block)) break;
+    _mm_storeu_si128((__m128i*)(copied + i), block);
+  }
+  return i;
+}
+
+size_t codepage::utf8_length_sse2(encoding_t encoding, std::string_view str, size_t& length) {
+  // Bytes 0x80-0xFF of Latin-1 and Windows-1252 outside of 0x80-0x9F are
+  // encoded as two bytes; in ASCII, they are decoded as a single '?'.
+  const __m128i zero = _mm_setzero_si128(), xA0 = _mm_set1_epi8(char(0xA0));
+  __m128i sums = zero;
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i*)(str.data() + i));
+    if (encoding == CP1252 && _mm_movemask_epi8(_mm_cmplt_epi8(block, xA0))) break;
+    if (encoding != ASCII) sums = _mm_add_epi64(sums, _mm_sad_epu8(_mm_sub_epi8(zero, _mm_cmplt_epi8(block, zero)), zero));
+  }
+  length += i + _mm_cvtsi128_si32(sums) + _mm_extract_epi16(sums, 4);
+  return i;
+}
+
+size_t codepage::decode_sse2(encoding_t encoding, std::string_view str, char16_t* decoded) {
+  const __m128i zero = _mm_setzero_si128(), xA0 = _mm_set1_epi8(char(0xA0));
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i*)(str.data() + i));
+    if (encoding == ASCII ? _mm_movemask_epi8(block) : encoding == CP1252 && _mm_movemask_epi8(_mm_cmplt_epi8(block, xA0))) break;
+    _mm_storeu_si128((__m128i*)(decoded + i), _mm_unpacklo_epi8(block, zero));
+    _mm_storeu_si128((__m128i*)(decoded + i + 8), _mm_unpackhi_epi8(block, zero));
+  }
+  return i;
+}
+
+size_t codepage::decode_sse2(encoding_t encoding, std::string_view str, char32_t* decoded) {
+  const __m128i zero = _mm_setzero_si128(), xA0 = _mm_set1_epi8(char(0xA0));
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i*)(str.data() + i));
+    if (encoding == ASCII ? _mm_movemask_epi8(block) : encoding == CP1252 && _mm_movemask_epi8(_mm_cmplt_epi8(block, xA0))) break;
+    __m128i low = _mm_unpacklo_epi8(block, zero), high = _mm_unpackhi_epi8(block, zero);
+    _mm_storeu_si128((__m128i*)(decoded + i), _mm_unpacklo_epi16(low, zero));
+    _mm_storeu_si128((__m128i*)(decoded + i + 4), _mm_unpackhi_epi16(low, zero));
+    _mm_storeu_si128((__m128i*)(decoded + i + 8), _mm_unpacklo_epi16(high, zero));
+    _mm_storeu_si128((__m128i*)(decoded + i + 12), _mm_unpackhi_epi16(high, zero));
+  }
+  return i;
+}
+
+size_t codepage::encode_sse2(encoding_t encoding, std::u16string_view str, char* encoded) {
+  // A code unit is mapped to itself if it has no bits of `outside` set, and
+  // in Windows-1252 if it is also not in 0x80-0x9F.
+  const __m128i zero = _mm_setzero_si128(), outside = _mm_set1_epi16(short(encoding == ASCII ? 0xFF80 : 0xFF00));
+  const __m128i xFFE0 = _mm_set1_epi16(short(0xFFE0)), x0080 = _mm_set1_epi16(0x80);
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m128i first = _mm_loadu_si128((const __m128i*)(str.data() + i)), second = _mm_loadu_si128((const __m128i*)(str.data() + i + 8));
+    __m128i mapped = _mm_and_si128(_mm_cmpeq_epi16(_mm_and_si128(first, outside), zero), _mm_cmpeq_epi16(_mm_and_si128(second, outside), zero));
+    if (encoding == CP1252)
+      mapped = _mm_andnot_si128(_mm_or_si128(_mm_cmpeq_epi16(_mm_and_si128(first, xFFE0), x0080), _mm_cmpeq_epi16(_mm_and_si128(second, xFFE0), x0080)), mapped);
+    if (_mm_movemask_epi8(mapped) != 0xFFFF) break;
+    _mm_storeu_si128((__m128i*)(encoded + i), _mm_packus_epi16(first, second));
+  }
+  return i;
+}
+
+size_t codepage::encode_sse2(encoding_t encoding, std::u32string_view str, char* encoded) {
+  // A code point is mapped to itself if it has no bits of `outside` set, and
+  // in Windows-1252 if it is also not in 0x80-0x9F.
+  const __m128i zero = _mm_setzero_si128(), outside = _mm_set1_epi32(encoding == ASCII ? ~0x7F : ~0xFF);
+  const __m128i xFFFFFFE0 = _mm_set1_epi32(~0x1F), x80 = _mm_set1_epi32(0x80);
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m128i blocks[4], mapped = _mm_set1_epi32(-1);
+    for (int j = 0; j < 4; j++) {
+      blocks[j] = _mm_loadu_si128((const __m128i*)(str.data() + i + 4 * j));
+      mapped = _mm_and_si128(mapped, _mm_cmpeq_epi32(_mm_and_si128(blocks[j], outside), zero));
+      if (encoding == CP1252) mapped = _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(blocks[j], xFFFFFFE0), x80), mapped);
+    }
+    if (_mm_movemask_epi8(mapped) != 0xFFFF) break;
+    _mm_storeu_si128((__m128i*)(encoded + i), _mm_packus_epi16(_mm_packs_epi32(blocks[0], blocks[1]), _mm_packs_epi32(blocks[2], blocks[3])));
+  }
+  return i;
+}
+#endif
+
+} // namespace unilib
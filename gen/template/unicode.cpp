@@ -11,6 +11,7 @@
 // Unicode version: $UNICODE_VERSION
 
 #include "unicode.h"
+#include "unistring.h"
 
 namespace unilib {
 
@@ -35,6 +36,18 @@ std::u32string unicode::titlecase_full(char32_t chr) {
   return std::u32string(1, unicode::titlecase(chr));
 }
 
+void unicode::lowercase_string(unistring& str) {
+  str.transform([](char32_t chr) { return lowercase(chr); });
+}
+
+void unicode::uppercase_string(unistring& str) {
+  str.transform([](char32_t chr) { return uppercase(chr); });
+}
+
+void unicode::titlecase_string(unistring& str) {
+  str.transform([](char32_t chr) { return titlecase(chr); });
+}
+
 const uint8_t unicode::category_index[unicode::CHARS >> 8] = $CATEGORY_INDICES;
 
 const uint8_t unicode::category_block[][256] = $CATEGORY_BLOCKS;
@@ -17,6 +17,8 @@
 
 namespace unilib {
 
+class unistring;
+
 // The `unicode` class contains basic information from
 // [Unicode Character Database](http://www.unicode.org/reports/tr44/), notably
 // - general categories
@@ -75,6 +77,13 @@ class unicode {
   static std::u32string uppercase_full(char32_t chr);
   static std::u32string titlecase_full(char32_t chr);
 
+  // Applies the simple lowercase/uppercase/titlecase mapping to every code
+  // point of the given `unistring`, choosing the smallest sufficient width
+  // for the result.
+  static void lowercase_string(unistring& str);
+  static void uppercase_string(unistring& str);
+  static void titlecase_string(unistring& str);
+
  private:
   inline static const char32_t CHARS = 0x110000;
   inline static const int32_t DEFAULT_CAT = Cn;
@@ -10,31 +10,344 @@
 // UniLib version: $UNILIB_VERSION
 // Unicode version: $UNICODE_VERSION
 
+#include <cstring>
+
 #include "uninorms.h"
+#include "unistring.h"
+#include "utf.h"
 
 namespace unilib {
 
 void uninorms::nfc(std::u32string& str) {
-  decompose(str, false);
-  compose(str);
+  normalize(str, NFC);
 }
 
 void uninorms::nfd(std::u32string& str) {
-  decompose(str, false);
+  normalize(str, NFD);
 }
 
 void uninorms::nfkc(std::u32string& str) {
-  decompose(str, true);
-  compose(str);
+  normalize(str, NFKC);
 }
 
 void uninorms::nfkd(std::u32string& str) {
-  decompose(str, true);
+  normalize(str, NFKD);
+}
+
+void uninorms::nfc(std::string_view str, std::string& normalized) {
+  normalize(str, normalized, NFC);
+}
+
+void uninorms::nfd(std::string_view str, std::string& normalized) {
+  normalize(str, normalized, NFD);
+}
+
+void uninorms::nfkc(std::string_view str, std::string& normalized) {
+  normalize(str, normalized, NFKC);
+}
+
+void uninorms::nfkd(std::string_view str, std::string& normalized) {
+  normalize(str, normalized, NFKD);
+}
+
+void uninorms::nfc_batch(std::u32string_view strs, const std::vector<size_t>& offsets, std::u32string& normalized, std::vector<size_t>& normalized_offsets) {
+  normalize_batch(strs, offsets, normalized, normalized_offsets, NFC);
+}
+
+void uninorms::nfd_batch(std::u32string_view strs, const std::vector<size_t>& offsets, std::u32string& normalized, std::vector<size_t>& normalized_offsets) {
+  normalize_batch(strs, offsets, normalized, normalized_offsets, NFD);
+}
+
+void uninorms::nfkc_batch(std::u32string_view strs, const std::vector<size_t>& offsets, std::u32string& normalized, std::vector<size_t>& normalized_offsets) {
+  normalize_batch(strs, offsets, normalized, normalized_offsets, NFKC);
+}
+
+void uninorms::nfkd_batch(std::u32string_view strs, const std::vector<size_t>& offsets, std::u32string& normalized, std::vector<size_t>& normalized_offsets) {
+  normalize_batch(strs, offsets, normalized, normalized_offsets, NFKD);
+}
+
+uninorms::quick_check_t uninorms::is_nfc(std::u32string_view str) {
+  return quick_check(str, NFC);
+}
+
+uninorms::quick_check_t uninorms::is_nfd(std::u32string_view str) {
+  return quick_check(str, NFD);
+}
+
+uninorms::quick_check_t uninorms::is_nfkc(std::u32string_view str) {
+  return quick_check(str, NFKC);
+}
+
+uninorms::quick_check_t uninorms::is_nfkd(std::u32string_view str) {
+  return quick_check(str, NFKD);
+}
+
+void uninorms::nfc(unistring& str) {
+  normalize(str, NFC);
+}
+
+void uninorms::nfd(unistring& str) {
+  normalize(str, NFD);
+}
+
+void uninorms::nfkc(unistring& str) {
+  normalize(str, NFKC);
+}
+
+void uninorms::nfkd(unistring& str) {
+  normalize(str, NFKD);
+}
+
+unsigned uninorms::ccc(char32_t chr) {
+  return ccc_block[ccc_index[chr >> 8]][chr & 0xFF];
+}
+
+uninorms::quick_check_t uninorms::quick_check(char32_t chr, form_t form) {
+  return quick_check_t((quick_check_block[quick_check_index[chr >> 8]][chr & 0xFF] >> (2 * form)) & 3);
+}
+
+uninorms::quick_check_t uninorms::quick_check(std::u32string_view str, form_t form) {
+  quick_check_t result = YES;
+  unsigned last_ccc = 0;
+  for (auto&& chr : str) {
+    if (chr >= CHARS) { last_ccc = 0; continue; }
+    unsigned chr_ccc = ccc(chr);
+    if (chr_ccc && last_ccc > chr_ccc) return NO;
+    auto check = quick_check(chr, form);
+    if (check == NO) return NO;
+    if (check == MAYBE) result = MAYBE;
+    last_ccc = chr_ccc;
+  }
+  return result;
+}
+
+size_t uninorms::stable_prefix(std::u32string_view str, form_t form) {
+  return stable_prefix_of(str, form);
+}
+
+size_t uninorms::stable_prefix(const unistring& str, form_t form) {
+  return stable_prefix_of(str, form);
+}
+
+size_t uninorms::stable_prefix(std::string_view str, form_t form) {
+  // The offset of the last stable code point before the first code point
+  // failing the quick check or invalid sequence, from which the UTF-8
+  // normalize starts renormalizing.
+  size_t stable = 0;
+  unsigned last_ccc = 0;
+  for (size_t i = 0, length; i < str.size(); i += length) {
+    char32_t chr;
+    if (((unsigned char)str[i]) < 0x80) { stable = i; last_ccc = 0; length = 1; continue; }
+    if (!decode_utf8(str.substr(i), chr, length)) return stable;
+    unsigned chr_ccc = ccc(chr);
+    if ((chr_ccc && last_ccc > chr_ccc) || quick_check(chr, form) != YES) return stable;
+    if (!chr_ccc) stable = i;
+    last_ccc = chr_ccc;
+  }
+  return str.size();
+}
+
+template<class String>
+size_t uninorms::stable_prefix_of(const String& str, form_t form) {
+  // A stable code point is a starter passing the quick check; the string
+  // before it is unaffected by the normalization of the rest.
+  size_t stable = 0;
+  unsigned last_ccc = 0;
+  for (size_t i = 0; i < str.size(); i++) {
+    if (str[i] < 0x80 || str[i] >= CHARS) { stable = i; last_ccc = 0; continue; }
+    unsigned chr_ccc = ccc(str[i]);
+    if (chr_ccc && last_ccc > chr_ccc) return stable;
+    if (quick_check(str[i], form) != YES) return stable;
+    if (!chr_ccc) stable = i;
+    last_ccc = chr_ccc;
+  }
+  return str.size();
+}
+
+bool uninorms::is_stable(char32_t chr, form_t form) {
+  return chr >= CHARS || (!ccc(chr) && quick_check(chr, form) == YES);
 }
 
-void uninorms::compose(std::u32string& str) {
+void uninorms::normalize(std::u32string& str, form_t form, size_t start) {
+  std::u32string scratch;
+  normalize(str, form, start, scratch);
+}
+
+void uninorms::normalize(std::u32string& str, form_t form, size_t start, std::u32string& scratch) {
+  size_t stable = start + stable_prefix(std::u32string_view(str).substr(start), form);
+  if (stable == str.size()) return;
+
+  renormalize(str, form, stable, scratch);
+}
+
+void uninorms::renormalize(std::u32string& str, form_t form, size_t start, std::u32string& scratch) {
+  decompose(str, form == NFKC || form == NFKD, start, scratch);
+  if (form == NFC || form == NFKC) compose(str, start);
+}
+
+void uninorms::normalize(unistring& str, form_t form) {
+  // The quick check reads the code points in the storage of any width, so
+  // strings already normalized are neither widened nor copied. The others
+  // are decoded and normalized only from their last stable code point on,
+  // and the result replaces that part of the storage.
+  size_t stable = stable_prefix(str, form);
+  if (stable == str.size()) return;
+
+  std::u32string rest = str.utf32(stable);
+  normalize(rest, form);
+  str.replace(stable, rest);
+  str.compact();
+}
+
+void uninorms::normalize_batch(std::u32string_view strs, const std::vector<size_t>& offsets, std::u32string& normalized, std::vector<size_t>& normalized_offsets, form_t form) {
+  normalized.clear();
+  normalized.reserve(offsets.empty() ? 0 : offsets.back() - offsets.front());
+  normalized_offsets.assign(1, 0);
+  normalized_offsets.reserve(std::max(offsets.size(), size_t(1)));
+
+  // Copy every string, and renormalize it in place from its last stable code
+  // point before the first one failing the quick check, decomposing through
+  // the scratch buffer shared by the whole batch.
+  // The input from `copied` on is copied lazily, so that consecutive strings
+  // passing the quick check are appended at once.
+  std::u32string scratch;
+  size_t copied = offsets.empty() ? 0 : offsets.front();
+  for (size_t i = 0; i + 1 < offsets.size(); i++) {
+    std::u32string_view str = strs.substr(offsets[i], offsets[i + 1] - offsets[i]);
+    size_t stable = stable_prefix(str, form);
+    if (stable < str.size()) {
+      normalized.append(strs.substr(copied, offsets[i + 1] - copied));
+      renormalize(normalized, form, normalized.size() - (str.size() - stable), scratch);
+      copied = offsets[i + 1];
+    }
+    normalized_offsets.push_back(normalized.size() + offsets[i + 1] - copied);
+  }
+  if (!offsets.empty()) normalized.append(strs.substr(copied, offsets.back() - copied));
+}
+
+void uninorms::normalize(std::string_view str, std::string& normalized, form_t form) {
+  normalized.clear();
+  normalized.reserve(str.size());
+
+  // The input up to `copied` has been written; `stable` is the offset of the
+  // last stable code point (or of `copied`) and `last_ccc` the combining
+  // class of the previous code point.
+  std::u32string segment, scratch;
+  std::string encoded;
+  size_t copied = 0, stable = 0;
+  unsigned last_ccc = 0;
+  for (size_t i = 0; i < str.size(); ) {
+    // Skip ASCII, which is stable, in blocks of eight characters if possible.
+    if (((unsigned char)str[i]) < 0x80) {
+      for (uint64_t block; i + 9 <= str.size(); i += 8) {
+        memcpy(&block, str.data() + i + 1, sizeof(block));
+        if (block & 0x8080808080808080ULL) break;
+      }
+      stable = i++;
+      last_ccc = 0;
+      continue;
+    }
+
+    char32_t chr;
+    size_t length;
+    if (decode_utf8(str.substr(i), chr, length)) {
+      unsigned chr_ccc = ccc(chr);
+      if (!(chr_ccc && last_ccc > chr_ccc) && quick_check(chr, form) == YES) {
+        if (!chr_ccc) stable = i;
+        last_ccc = chr_ccc;
+        i += length;
+        continue;
+      }
+    }
+
+    // Renormalize the segment from the last stable code point up to the next
+    // one, copying the preceding input verbatim.
+    size_t end = i + length;
+    for (size_t next_length; end < str.size(); end += next_length) {
+      if (((unsigned char)str[end]) < 0x80) break;
+      if (decode_utf8(str.substr(end), chr, next_length) && !ccc(chr) && quick_check(chr, form) == YES) break;
+    }
+    normalized.append(str.data() + copied, stable - copied);
+    utf::decode(str.substr(stable, end - stable), segment);
+    renormalize(segment, form, 0, scratch);
+    utf::encode(segment, encoded);
+    normalized.append(encoded);
+    copied = stable = i = end;
+    last_ccc = 0;
+  }
+  normalized.append(str.data() + copied, str.size() - copied);
+}
+
+uninorms::stream_normalizer::stream_normalizer(form_t form) : form(form) {}
+
+void uninorms::stream_normalizer::feed(std::u32string_view chunk, std::u32string& normalized) {
+  // Normalize the pending input and the chunk up to its last stable code
+  // point, which starts the new pending input.
+  size_t last_stable = chunk.size();
+  while (last_stable && !is_stable(chunk[last_stable - 1], form)) last_stable--;
+  if (!last_stable) {
+    pending.append(chunk);
+    return;
+  }
+
+  size_t start = normalized.size();
+  normalized.append(pending).append(chunk.substr(0, last_stable - 1));
+  normalize(normalized, form, start, scratch);
+  pending.assign(chunk.substr(last_stable - 1));
+}
+
+void uninorms::stream_normalizer::finish(std::u32string& normalized) {
+  size_t start = normalized.size();
+  normalized.append(pending);
+  normalize(normalized, form, start, scratch);
+  pending.clear();
+}
+
+std::vector<size_t> uninorms::stable_chunks(std::u32string_view str, form_t form, size_t chunk_size) {
+  // Start every chunk at the first stable code point after the nominal
+  // chunk boundary.
+  if (!chunk_size) chunk_size = 1;
+  std::vector<size_t> starts(1, 0);
+  for (size_t offset = chunk_size; offset < str.size(); offset = starts.back() + chunk_size) {
+    while (offset < str.size() && !is_stable(str[offset], form)) offset++;
+    if (offset == str.size()) break;
+    starts.push_back(offset);
+  }
+  starts.push_back(str.size());
+  return starts;
+}
+
+std::vector<size_t> uninorms::stable_chunks(std::string_view str, form_t form, size_t chunk_size) {
+  // Start every chunk at the first ASCII character or valid sequence of a
+  // stable code point after the nominal chunk boundary. Neither of them can
+  // be a part of a preceding invalid sequence, so the chunks are decoded the
+  // same way as the whole string.
+  if (!chunk_size) chunk_size = 1;
+  std::vector<size_t> starts(1, 0);
+  for (size_t offset = chunk_size; offset < str.size(); offset = starts.back() + chunk_size) {
+    for (char32_t chr; offset < str.size(); offset++)
+      if (size_t length; ((unsigned char)str[offset]) < 0x80 ||
+          (decode_utf8(str.substr(offset), chr, length) && is_stable(chr, form))) break;
+    if (offset == str.size()) break;
+    starts.push_back(offset);
+  }
+  starts.push_back(str.size());
+  return starts;
+}
+
+bool uninorms::decode_utf8(std::string_view str, char32_t& chr, size_t& length) {
+  // Decode leniently, and check that the sequence is valid UTF-8 (of a code
+  // point which `utf::encode` writes the same way), not a replacement.
+  std::string_view rest = str;
+  chr = utf::decode(rest);
+  length = str.size() - rest.size();
+  return length == (chr < 0x80 ? 1U : chr < 0x800 ? 2U : chr < 0x10000 ? 3U : 4U) && chr < CHARS &&
+    !(chr >= 0xD800 && chr < 0xE000) && !(chr == '?' && str.front() != '?');
+}
+
+void uninorms::compose(std::u32string& str, size_t start) {
   size_t old, com;
-  for (old = 0, com = 0; old < str.size(); old++, com++) {
+  for (old = start, com = start; old < str.size(); old++, com++) {
     str[com] = str[old];
     if (str[old] >= Hangul::LBase && str[old] < Hangul::LBase + Hangul::LCount) {
       // Check Hangul composition L + V [+ T].
@@ -49,29 +362,19 @@ void uninorms::compose(std::u32string& str) {
       if ((str[old] - Hangul::SBase) % Hangul::TCount && old + 1 < str.size() && str[old + 1] > Hangul::TBase && str[old + 1] < Hangul::TBase + Hangul::TCount)
         str[com] += str[++old] - Hangul::TBase;
     } else if (str[old] < CHARS) {
-      // Check composition_data
-      auto composition = &composition_block[composition_index[str[old] >> 8]][str[old] & 0xFF];
+      // Check the composition table.
       auto starter = com;
       for (int last_ccc = -1; old + 1 < str.size(); old++) {
-        int ccc = str[old + 1] < CHARS ? ccc_block[ccc_index[str[old + 1] >> 8]][str[old + 1] & 0xFF] : 0;
-        if (composition[1] - composition[0] && last_ccc < ccc) {
-          // Try finding a composition.
-          auto l = composition[0], r = composition[1];
-          while (l + 2 < r) {
-            auto m = l + (((r - l) >> 1) & ~1);
-            if (composition_data[m] <= str[old + 1]) l = m;
-            if (composition_data[m] >= str[old + 1]) r = m;
-          }
-          if (composition_data[l] == str[old + 1]) {
+        int second_ccc = str[old + 1] < CHARS ? ccc(str[old + 1]) : 0;
+        if (last_ccc < second_ccc && str[old + 1] < CHARS)
+          if (char32_t composite = composition(str[starter], str[old + 1])) {
             // Found a composition.
-            str[starter] = composition_data[l + 1];
-            composition = &composition_block[composition_index[composition_data[l + 1] >> 8]][composition_data[l + 1] & 0xFF];
+            str[starter] = composite;
             continue;
           }
-        }
 
-        if (!ccc) break;
-        last_ccc = ccc;
+        if (!second_ccc) break;
+        last_ccc = second_ccc;
         str[++com] = str[old + 1];
       }
     }
@@ -80,83 +383,88 @@ void uninorms::compose(std::u32string& str) {
   if (com < old) str.resize(com);
 }
 
-void uninorms::decompose(std::u32string& str, bool kompatibility) {
-  // Count how much additional space do we need.
-  bool any_decomposition = false;
-  size_t additional = 0;
-  for (auto&& chr : str) {
-    int decomposition_len = 0;
-
-    if (chr >= Hangul::SBase && chr < Hangul::SBase + Hangul::SCount) {
-      // Hangul decomposition.
-      decomposition_len = 2 + ((chr - Hangul::SBase) % Hangul::TCount ? 1 : 0);
-    } else if (chr < CHARS) {
-      // Check decomposition_data.
-      auto decomposition = &decomposition_block[decomposition_index[chr >> 8]][chr & 0xFF];
-      decomposition_len = (decomposition[1] >> 2) - (decomposition[0] >> 2);
-      if (decomposition_len && !kompatibility && (decomposition[0] & 1)) decomposition_len = 0;
-      if (decomposition_len && kompatibility && (decomposition[0] & 2))
-        // Further kompatibility decomposition.
-        for (auto i = decomposition[0] >> 2; i < decomposition[1] >> 2; i++) {
-          auto further_decomposition = &decomposition_block[decomposition_index[decomposition_data[i] >> 8]][decomposition_data[i] & 0xFF];
-          if (further_decomposition[0] & 1) decomposition_len += (further_decomposition[1] >> 2) - (further_decomposition[0] >> 2) - 1;
-        }
-    }
-    // Do we decompose current character?
-    if (!decomposition_len) continue;
-    any_decomposition = true;
-    additional += decomposition_len - 1;
+char32_t uninorms::composition(char32_t starter, char32_t second) {
+  uint32_t hash = (uint32_t(starter) * 0x9E3779B1U) ^ (uint32_t(second) * 0x85EBCA77U);
+  uint32_t slot = ((hash ^ composition_seeds[hash >> (32 - COMPOSITION_BUCKET_BITS)]) * 0xC2B2AE3DU) >> (32 - COMPOSITION_SLOT_BITS);
+  uint64_t entry = composition_table[slot];
+  return (entry >> 21) == ((uint64_t(starter) << 21) | second) ? char32_t(entry & 0x1FFFFF) : 0;
+}
+
+void uninorms::decompose(std::u32string& str, bool kompatibility, size_t start, std::u32string& scratch) {
+  auto index = kompatibility ? kompatibility_decomposition_index : decomposition_index;
+  auto block = kompatibility ? kompatibility_decomposition_block : decomposition_block;
+  auto data = kompatibility ? kompatibility_decomposition_data : decomposition_data;
+
+  // Skip the prefix of characters which are not decomposed and which are
+  // not combining marks.
+  size_t i = start;
+  for (; i < str.size(); i++) {
+    if (str[i] >= CHARS) continue;
+    if (str[i] >= Hangul::SBase && str[i] < Hangul::SBase + Hangul::SCount) break;
+    auto decomposition = &block[index[str[i] >> 8]][str[i] & 0xFF];
+    if (decomposition[0] != (decomposition[1] & ~1)) break;
   }
+  if (i == str.size()) return;
 
-  // If needed, allocate enough space and perform the decomposition.
-  if (any_decomposition) {
-    str.resize(str.size() + additional);
-    for (size_t dec = str.size(), old = dec - additional; old--; )
-      if (str[old] >= Hangul::SBase && str[old] < Hangul::SBase + Hangul::SCount) {
-        // Hangul decomposition.
-        char32_t s_index = str[old] - Hangul::SBase;
-        if (s_index % Hangul::TCount) str[--dec] = Hangul::TBase + s_index % Hangul::TCount;
-        str[--dec] = Hangul::VBase + (s_index % Hangul::NCount) / Hangul::TCount;
-        str[--dec] = Hangul::LBase + s_index / Hangul::NCount;
-      } else if (str[old] < CHARS) {
-        // Check decomposition_data.
-        auto decomposition = &decomposition_block[decomposition_index[str[old] >> 8]][str[old] & 0xFF];
-        int decomposition_len = (decomposition[1] >> 2) - (decomposition[0] >> 2);
-        if (decomposition_len && !kompatibility && (decomposition[0] & 1)) decomposition_len = 0;
-        if (decomposition_len && kompatibility && (decomposition[0] & 2)) {
-          // Further kompatibility decomposition.
-          while (decomposition_len--) {
-            auto chr = decomposition_data[(decomposition[0] >> 2) + decomposition_len];
-            auto further_decomposition = &decomposition_block[decomposition_index[chr >> 8]][chr & 0xFF];
-            if (further_decomposition[0] & 1) {
-              for (int further_decomposition_len = (further_decomposition[1] >> 2) - (further_decomposition[0] >> 2); further_decomposition_len--; )
-                str[--dec] = decomposition_data[(further_decomposition[0] >> 2) + further_decomposition_len];
-            } else {
-              str[--dec] = chr;
-            }
-          }
-        } else if (decomposition_len) {
-          // Non-recursive decomposition.
-          while (decomposition_len--)
-            str[--dec] = decomposition_data[(decomposition[0] >> 2) + decomposition_len];
-        } else {
-          // No decomposition.
-          str[--dec] = str[old];
-        }
+  // Write the decompositions of the rest of the string forward into the
+  // scratch buffer, whose first `length` characters are used, and replace
+  // the rest by them; the prefix is neither copied nor moved. The segments
+  // containing combining marks are put into canonical order when they end,
+  // i.e., before a decomposition without combining marks, which consists of
+  // starters only; the other segments are not reordered at all.
+  size_t rest = i, rest_size = str.size() - rest;
+  if (scratch.size() < rest_size + (rest_size >> 1) + 4) scratch.resize(rest_size + (rest_size >> 1) + 4);
+  size_t length = 0, unordered = std::u32string::npos;
+  for (; i < str.size(); i++) {
+    char32_t chr = str[i];
+    if (scratch.size() - length < 3) scratch.resize(2 * scratch.size());
+    if (chr >= CHARS || (chr >= Hangul::SBase && chr < Hangul::SBase + Hangul::SCount)) {
+      if (unordered != std::u32string::npos) {
+        canonical_order(scratch, unordered, length);
+        unordered = std::u32string::npos;
+      }
+      if (chr >= CHARS) {
+        scratch[length++] = chr;
       } else {
-        // Non-Unicode character.
-        str[--dec] = str[old];
+        // Hangul decomposition.
+        char32_t s_index = chr - Hangul::SBase;
+        scratch[length++] = Hangul::LBase + s_index / Hangul::NCount;
+        scratch[length++] = Hangul::VBase + (s_index % Hangul::NCount) / Hangul::TCount;
+        if (s_index % Hangul::TCount) scratch[length++] = Hangul::TBase + s_index % Hangul::TCount;
       }
+      continue;
+    }
+
+    auto decomposition = &block[index[chr >> 8]][chr & 0xFF];
+    if (decomposition[0] & 1) {
+      if (unordered == std::u32string::npos) unordered = length;
+    } else if (unordered != std::u32string::npos) {
+      canonical_order(scratch, unordered, length);
+      unordered = std::u32string::npos;
+    }
+    size_t decomposition_len = (decomposition[1] >> 1) - (decomposition[0] >> 1);
+    if (!decomposition_len) {
+      scratch[length++] = chr;
+    } else {
+      if (scratch.size() - length < decomposition_len) scratch.resize(2 * scratch.size() + decomposition_len);
+      std::copy(data + (decomposition[0] >> 1), data + (decomposition[1] >> 1), scratch.begin() + length);
+      length += decomposition_len;
+    }
   }
+  if (unordered != std::u32string::npos) canonical_order(scratch, unordered, length);
+  str.replace(rest, std::u32string::npos, scratch.data(), length);
+}
 
-  // Sort combining marks.
-  for (size_t i = 1; i < str.size(); i++) {
-    unsigned ccc = str[i] < CHARS ? ccc_block[ccc_index[str[i] >> 8]][str[i] & 0xFF] : 0;
-    if (!ccc) continue;
+void uninorms::canonical_order(std::u32string& str, size_t start, size_t end) {
+  // Sort combining marks between `start` and `end`; the character preceding
+  // `start` (if any) is a starter.
+  for (size_t i = start + 1; i < end; i++) {
+    unsigned chr_ccc = str[i] < CHARS ? ccc(str[i]) : 0;
+    if (!chr_ccc) continue;
 
     auto chr = str[i];
     size_t j;
-    for (j = i; j && (str[j-1] < CHARS ? ccc_block[ccc_index[str[j-1] >> 8]][str[j-1] & 0xFF] : 0) > ccc; j--) str[j] = str[j-1];
+    for (j = i; j > start && (str[j-1] < CHARS ? ccc(str[j-1]) : 0) > chr_ccc; j--) str[j] = str[j-1];
     str[j] = chr;
   }
 }
@@ -165,12 +473,18 @@ void uninorms::decompose(std::u32string& str, bool kompatibility) {
 const uint8_t uninorms::ccc_index[uninorms::CHARS >> 8] = $CCC_INDICES;
 const uint8_t uninorms::ccc_block[][256] = $CCC_BLOCKS;
 
-const uint8_t uninorms::composition_index[uninorms::CHARS >> 8] = $COMPOSITION_INDICES;
-const uint16_t uninorms::composition_block[][257] = $COMPOSITION_BLOCKS;
-const char32_t uninorms::composition_data[] = $COMPOSITION_DATA;
+const uint16_t uninorms::composition_seeds[1 << uninorms::COMPOSITION_BUCKET_BITS] = $COMPOSITION_SEEDS;
+const uint64_t uninorms::composition_table[1 << uninorms::COMPOSITION_SLOT_BITS] = $COMPOSITION_TABLE;
 
 const uint8_t uninorms::decomposition_index[uninorms::CHARS >> 8] = $DECOMPOSITION_INDICES;
 const uint16_t uninorms::decomposition_block[][257] = $DECOMPOSITION_BLOCKS;
 const char32_t uninorms::decomposition_data[] = $DECOMPOSITION_DATA;
 
+const uint8_t uninorms::kompatibility_decomposition_index[uninorms::CHARS >> 8] = $KOMPATIBILITY_DECOMPOSITION_INDICES;
+const uint16_t uninorms::kompatibility_decomposition_block[][257] = $KOMPATIBILITY_DECOMPOSITION_BLOCKS;
+const char32_t uninorms::kompatibility_decomposition_data[] = $KOMPATIBILITY_DECOMPOSITION_DATA;
+
+const uint8_t uninorms::quick_check_index[uninorms::CHARS >> 8] = $QUICK_CHECK_INDICES;
+const uint8_t uninorms::quick_check_block[][256] = $QUICK_CHECK_BLOCKS;
+
 } // namespace unilib
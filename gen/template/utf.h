@@ -12,9 +12,40 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
 #include <iterator>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// SIMD kernels. The SSE2 ones are used whenever the compiler targets SSE2;
+// the AVX2 and AVX-512 ones are compiled using target attributes on x86-64
+// and are selected at runtime according to CPUID. Defining UNILIB_NO_SIMD
+// disables all of them, leaving only the scalar implementations.
+#if !defined(UNILIB_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define UNILIB_UTF_SSE2
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#if defined(_M_X64) || defined(_M_AMD64)
+#define UNILIB_UTF_AVX2
+#define UNILIB_UTF_AVX512
+#define UNILIB_UTF_TARGET_AVX2
+#define UNILIB_UTF_TARGET_AVX512
+#endif
+#elif defined(__GNUC__) && defined(__x86_64__)
+#define UNILIB_UTF_AVX2
+#define UNILIB_UTF_AVX512
+#define UNILIB_UTF_TARGET_AVX2 __attribute__((target("avx2")))
+#define UNILIB_UTF_TARGET_AVX512 __attribute__((target("avx2,avx512f,avx512bw")))
+#endif
+#endif
 
 namespace unilib {
 
@@ -39,6 +70,11 @@ class utf {
   inline static bool valid(const char32_t* str);
   inline static bool valid(std::u32string_view str);
 
+  // Strict validity of UTF-8, which also rejects overlong forms, encoded
+  // surrogates, and code points above U+10FFFF
+  inline static bool valid_strict(const char* str);
+  inline static bool valid_strict(std::string_view str);
+
   // First code point decoding
   inline static char32_t first(const char* str);
   inline static char32_t first(std::string_view str);
@@ -53,12 +89,58 @@ class utf {
   inline static char32_t decode(const char16_t*& str);
   inline static char32_t decode(std::u16string_view& str);
 
-  // Decoding of a whole string
-  inline static void decode(const char* str, std::u32string& decoded);
-  inline static void decode(std::string_view str, std::u32string& decoded);
+  // Last code point decoding, producing the same code points as forward
+  // decoding (in reverse order), possibly removing it from the end
+  inline static char32_t last(std::string_view str);
+  inline static char32_t last(std::u16string_view str);
+
+  inline static char32_t decode_last(std::string_view& str);
+  inline static char32_t decode_last(std::u16string_view& str);
+
+  // Code point boundaries, i.e., offsets at which decoding starts a code
+  // point, snapped backwards or forwards from any offset (offsets past the
+  // end are snapped to the end). At most three preceding bytes (or one
+  // preceding code unit) are inspected.
+  inline static size_t boundary_before(std::string_view str, size_t offset);
+  inline static size_t boundary_before(std::u16string_view str, size_t offset);
+
+  inline static size_t boundary_after(std::string_view str, size_t offset);
+  inline static size_t boundary_after(std::u16string_view str, size_t offset);
+
+  // Truncation to at most `size` code units, or to at most `code_points`
+  // code points, without splitting a code point
+  inline static std::string_view truncate(std::string_view str, size_t size);
+  inline static std::u16string_view truncate(std::u16string_view str, size_t size);
+
+  inline static std::string_view truncate_code_points(std::string_view str, size_t code_points);
+  inline static std::u16string_view truncate_code_points(std::u16string_view str, size_t code_points);
+
+  // Error policies of the whole-string decoding, encoding, and transcoding
+  // methods, which are templated on them so that the policy is resolved at
+  // compile time. An error is an invalid sequence, or a code point which
+  // cannot be encoded in the target encoding. It can be replaced by a given
+  // code point (the default is '?'), skipped, or it can stop the conversion.
+  // The pass_surrogates policy decodes invalid UTF-8 bytes as U+DC80-U+DCFF
+  // and lone UTF-16 surrogates as themselves (so that UTF-16 is transcoded to
+  // WTF-8), replacing other errors by U+FFFD.
+  enum error_action_t { REPLACE, SKIP, STOP, PASS_SURROGATES };
+  template<error_action_t Action, char32_t Replacement = 0xFFFD>
+  struct error_policy {
+    static constexpr error_action_t action = Action;
+    static constexpr char32_t replacement = Replacement;
+  };
+  using replace_question_mark = error_policy<REPLACE, '?'>;
+  using replace_fffd = error_policy<REPLACE, 0xFFFD>;
+  using skip_errors = error_policy<SKIP>;
+  using stop_on_error = error_policy<STOP>;
+  using pass_surrogates = error_policy<PASS_SURROGATES>;
+
+  // Decoding of a whole string; returns false if an error occurred
+  template<class Policy = replace_question_mark> inline static bool decode(const char* str, std::u32string& decoded);
+  template<class Policy = replace_question_mark> inline static bool decode(std::string_view str, std::u32string& decoded);
 
-  inline static void decode(const char16_t* str, std::u32string& decoded);
-  inline static void decode(std::u16string_view str, std::u32string& decoded);
+  template<class Policy = replace_question_mark> inline static bool decode(const char16_t* str, std::u32string& decoded);
+  template<class Policy = replace_question_mark> inline static bool decode(std::u16string_view str, std::u32string& decoded);
 
   // Iterator decoding
   template<class Char>
@@ -75,12 +157,20 @@ class utf {
   inline static string_decoder<char> decoder(const char* str);
   inline static string_decoder<char16_t> decoder(const char16_t* str);
 
+  // Bidirectional iterator over a string_view, yielding either the code
+  // points (char32_t) or the code points with their offsets (decoded_t)
+  template<class Char, class Value>
+  class view_iterator;
+
   template<class Char>
   class buffer_decoder {
    public:
-    class iterator;
+    using iterator = view_iterator<Char, char32_t>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
     inline iterator begin();
     inline iterator end();
+    inline reverse_iterator rbegin();
+    inline reverse_iterator rend();
    private:
     inline buffer_decoder(std::basic_string_view<Char> str);
     std::basic_string_view<Char> str;
@@ -89,6 +179,68 @@ class utf {
   inline static buffer_decoder<char> decoder(std::string_view str);
   inline static buffer_decoder<char16_t> decoder(std::u16string_view str);
 
+  // Iterator decoding yielding also the offset and length (in code units)
+  // of the sequence of every code point
+  struct decoded_t {
+    char32_t codepoint;
+    size_t offset;
+    uint8_t length;
+  };
+  template<class Char>
+  class offset_decoder {
+   public:
+    using iterator = view_iterator<Char, decoded_t>;
+    inline iterator begin();
+    inline iterator end();
+   private:
+    inline offset_decoder(std::basic_string_view<Char> str);
+    std::basic_string_view<Char> str;
+    friend class utf;
+  };
+  inline static offset_decoder<char> offsets(std::string_view str);
+  inline static offset_decoder<char16_t> offsets(std::u16string_view str);
+
+  // Index of a UTF-8 string, converting among UTF-8, UTF-16, and UTF-32 (code
+  // point) offsets of its code points, as decoded and transcoded by the
+  // whole-string methods. The offsets of every `step`-th code point are
+  // stored, so a conversion is a lookup followed by a scan of at most `step`
+  // code points. Offsets inside a code point are mapped to its start, offsets
+  // past the end to the end. The string is not copied, and must outlive the
+  // index.
+  class offset_index {
+   public:
+    inline offset_index(std::string_view str, size_t step = 64);
+
+    inline size_t utf8_to_utf16(size_t offset) const;
+    inline size_t utf8_to_utf32(size_t offset) const;
+    inline size_t utf16_to_utf8(size_t offset) const;
+    inline size_t utf16_to_utf32(size_t offset) const;
+    inline size_t utf32_to_utf8(size_t offset) const;
+    inline size_t utf32_to_utf16(size_t offset) const;
+   private:
+    struct checkpoint_t { size_t offsets[3]; };
+    inline size_t convert(size_t offset, unsigned from, unsigned to) const;
+    std::string_view str;
+    size_t step;
+    std::vector<checkpoint_t> checkpoints;
+  };
+
+  // Incremental decoding of a string split into chunks, appending the code
+  // points to `decoded`. A sequence cut by the end of a chunk (at most three
+  // UTF-8 bytes or one high surrogate) is kept until the next `feed`, and
+  // `finish` decodes whatever is left, making the decoder ready for another
+  // string. The result is the same as decoding the whole string at once;
+  // both methods return false if an error occurred.
+  template<class Char, class Policy = replace_question_mark>
+  class stream_decoder {
+   public:
+    inline bool feed(std::basic_string_view<Char> chunk, std::u32string& decoded);
+    inline bool finish(std::u32string& decoded);
+   private:
+    Char pending[4];
+    size_t pending_length = 0;
+  };
+
   // Appending a single code point
   inline static void append(char*& str, char32_t chr);
   inline static void append(std::string& str, char32_t chr);
@@ -96,16 +248,324 @@ class utf {
   inline static void append(char16_t*& str, char32_t chr);
   inline static void append(std::u16string& str, char32_t chr);
 
-  // Encoding a whole string
-  inline static void encode(const char32_t* str, std::string& encoded);
-  inline static void encode(std::u32string_view str, std::string& encoded);
+  // Encoding a whole string; returns false if an error occurred
+  template<class Policy = replace_question_mark> inline static bool encode(const char32_t* str, std::string& encoded);
+  template<class Policy = replace_question_mark> inline static bool encode(std::u32string_view str, std::string& encoded);
+
+  template<class Policy = replace_question_mark> inline static bool encode(const char32_t* str, std::u16string& encoded);
+  template<class Policy = replace_question_mark> inline static bool encode(std::u32string_view str, std::u16string& encoded);
 
-  inline static void encode(const char32_t* str, std::u16string& encoded);
-  inline static void encode(std::u32string_view str, std::u16string& encoded);
+  // Transcoding a whole string between UTF-8 and UTF-16, equivalent to
+  // decoding it and encoding the result; returns false if an error occurred
+  template<class Policy = replace_question_mark> inline static bool transcode(const char* str, std::u16string& transcoded);
+  template<class Policy = replace_question_mark> inline static bool transcode(std::string_view str, std::u16string& transcoded);
+
+  template<class Policy = replace_question_mark> inline static bool transcode(const char16_t* str, std::string& transcoded);
+  template<class Policy = replace_question_mark> inline static bool transcode(std::u16string_view str, std::string& transcoded);
+
+  // Variants of UTF-8, processed strictly (rejecting overlong forms and code
+  // points above U+10FFFF) by the methods templated on them:
+  // - `UTF8` is the standard UTF-8;
+  // - `CESU8` encodes supplementary code points as pairs of 3-byte
+  //   surrogate sequences;
+  // - `MUTF8` is the Modified UTF-8 used by JNI and Java serialization,
+  //   i.e., CESU-8 encoding U+0000 as 0xC0 0x80, so it has no zero bytes;
+  // - `WTF8` is UTF-8 allowing also lone surrogates (but not surrogate pairs),
+  //   which represents any, possibly ill-formed, UTF-16 losslessly.
+  enum utf8_variant_t { UTF8, CESU8, MUTF8, WTF8 };
+  template<utf8_variant_t Variant> inline static bool valid(std::string_view str);
+
+  // Decoding, encoding, and transcoding of a whole string in a UTF-8 variant,
+  // like the methods above. WTF-8 lone surrogates are decoded as surrogate
+  // code points and transcoded as lone UTF-16 surrogates, and vice versa;
+  // surrogate code points forming a pair are encoded as one code point.
+  template<utf8_variant_t Variant, class Policy = replace_question_mark> inline static bool decode(std::string_view str, std::u32string& decoded);
+  template<utf8_variant_t Variant, class Policy = replace_question_mark> inline static bool encode(std::u32string_view str, std::string& encoded);
+  template<utf8_variant_t Variant, class Policy = replace_question_mark> inline static bool transcode(std::string_view str, std::u16string& transcoded);
+  template<utf8_variant_t Variant, class Policy = replace_question_mark> inline static bool transcode(std::u16string_view str, std::string& transcoded);
+
+  // Converting a whole string between two UTF-8 variants in a single pass;
+  // returns false if an error occurred
+  template<utf8_variant_t From, utf8_variant_t To, class Policy = replace_question_mark>
+  inline static bool recode(std::string_view str, std::string& recoded);
+
+  // Executor of the parallel methods, calling `task(i)` for all `i` below
+  // `tasks` on the calling thread and at most `threads - 1` new threads.
+  // The threads are started and joined on every call, which costs tens of
+  // microseconds per thread, so the chunks should be large enough to make
+  // that negligible. Any other executor with the same call operator can be
+  // used instead, for example one running the tasks on an existing pool of
+  // threads kept alive between calls.
+  class thread_executor {
+   public:
+    inline thread_executor(unsigned threads = std::thread::hardware_concurrency());
+    template<class Task> inline void operator()(size_t tasks, const Task& task) const;
+   private:
+    unsigned threads;
+  };
+
+  // Parallel decoding, encoding, and transcoding of a whole string, producing
+  // the same result as the serial methods. The string is split on code point
+  // boundaries into chunks of about `chunk_size` code units. The chunks are
+  // analyzed concurrently, their output lengths are prefix-summed to size the
+  // result exactly, and they are then converted concurrently directly into
+  // it; only chunks containing errors are converted into a temporary string.
+  template<class Policy = replace_question_mark, class Executor = thread_executor>
+  inline static bool decode_parallel(std::string_view str, std::u32string& decoded, size_t chunk_size = 1 << 20, Executor&& run = Executor());
+  template<class Policy = replace_question_mark, class Executor = thread_executor>
+  inline static bool decode_parallel(std::u16string_view str, std::u32string& decoded, size_t chunk_size = 1 << 20, Executor&& run = Executor());
+
+  template<class Policy = replace_question_mark, class Executor = thread_executor>
+  inline static bool encode_parallel(std::u32string_view str, std::string& encoded, size_t chunk_size = 1 << 20, Executor&& run = Executor());
+  template<class Policy = replace_question_mark, class Executor = thread_executor>
+  inline static bool encode_parallel(std::u32string_view str, std::u16string& encoded, size_t chunk_size = 1 << 20, Executor&& run = Executor());
+
+  template<class Policy = replace_question_mark, class Executor = thread_executor>
+  inline static bool transcode_parallel(std::string_view str, std::u16string& transcoded, size_t chunk_size = 1 << 20, Executor&& run = Executor());
+  template<class Policy = replace_question_mark, class Executor = thread_executor>
+  inline static bool transcode_parallel(std::u16string_view str, std::string& transcoded, size_t chunk_size = 1 << 20, Executor&& run = Executor());
+
+  // Lengths of the results of decoding, encoding, and transcoding a whole string
+  inline static size_t utf32_length(std::string_view str);
+  inline static size_t utf32_length(std::u16string_view str);
+
+  inline static size_t utf8_length(std::u32string_view str);
+  inline static size_t utf16_length(std::u32string_view str);
+
+  inline static size_t utf8_length(std::u16string_view str);
+  inline static size_t utf16_length(std::string_view str);
+
+  // Single-pass analysis of a string: whether it is valid and the offset of
+  // its first invalid sequence (or npos), whether it is all ASCII, its largest
+  // code point, and the lengths of its UTF-8, UTF-16, and UTF-32 forms
+  // produced by the whole-string methods (the latter being the number of
+  // code points)
+  struct profile_t {
+    bool valid;
+    size_t error_offset;
+    bool ascii;
+    char32_t max_code_point;
+    size_t utf8_length;
+    size_t utf16_length;
+    size_t utf32_length;
+  };
+  inline static profile_t analyze(std::string_view str);
+  inline static profile_t analyze(std::u16string_view str);
+
+  // Converting into a caller-provided buffer of a given size, without any
+  // allocation. The conversion stops at the end of the input (`OK`), before
+  // a code point not fitting into the output (`OUTPUT_FULL`), at an invalid
+  // sequence or a code point which the whole-string methods would replace
+  // (`INVALID`), or at a sequence cut short by the end of the input
+  // (`TRUNCATED`). The numbers of consumed input and written output code
+  // units allow resuming the conversion; the lengths above are always
+  // sufficient output sizes for valid inputs.
+  enum status_t { OK, OUTPUT_FULL, INVALID, TRUNCATED };
+  struct result_t {
+    status_t status;
+    size_t consumed;
+    size_t written;
+  };
+  inline static result_t decode_into(std::string_view str, char32_t* decoded, size_t size);
+  inline static result_t decode_into(std::u16string_view str, char32_t* decoded, size_t size);
+
+  inline static result_t encode_into(std::u32string_view str, char* encoded, size_t size);
+  inline static result_t encode_into(std::u32string_view str, char16_t* encoded, size_t size);
+
+  inline static result_t transcode_into(std::string_view str, char16_t* transcoded, size_t size);
+  inline static result_t transcode_into(std::u16string_view str, char* transcoded, size_t size);
 
  private:
   // The REPLACEMENT_CHAR used to represent invalid code points.
   inline static const char REPLACEMENT_CHAR = '?';
+
+  // The DFA performing strict UTF-8 validation. Every byte is mapped to one
+  // of 12 classes; the transitions of a class are stored in a 64-bit row,
+  // where the next state of a state `s` occupies 6 bits starting at bit `s`.
+  inline static const uint64_t STRICT_ACCEPT = 0, STRICT_ERROR = 6;
+  inline static const uint8_t strict_classes[256] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+    4,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    6,7,7,7,7,7,7,7,7,7,7,7,7,8,7,7,9,10,10,10,11,4,4,4,4,4,4,4,4,4,4,4,
+  };
+  inline static const uint64_t strict_transitions[12] = {
+    0x0006186186186180, 0x001218C192300186, 0x000648C192300186, 0x0006486312300186,
+    0x0006186186186186, 0x000618618618618C, 0x000618618618619E, 0x0006186186186192,
+    0x00061861861861A4, 0x00061861861861AA, 0x0006186186186198, 0x00061861861861B0,
+  };
+
+  // The SIMD instruction sets available at runtime.
+  enum simd_t { SIMD_NONE, SIMD_SSE2, SIMD_AVX2, SIMD_AVX512 };
+  inline static simd_t simd();
+
+  // The SIMD kernels process the longest prefix of whole blocks they can
+  // and return its length; the rest is left to the scalar implementation.
+  // The validation kernels return std::string_view::npos on invalid input.
+#ifdef UNILIB_UTF_SSE2
+  inline static size_t valid_sse2(std::string_view str);
+#endif
+#ifdef UNILIB_UTF_AVX2
+  UNILIB_UTF_TARGET_AVX2 inline static size_t valid_avx2(std::string_view str);
+#endif
+#ifdef UNILIB_UTF_AVX512
+  UNILIB_UTF_TARGET_AVX512 inline static size_t valid_avx512(std::string_view str);
+#endif
+  inline static size_t valid_simd(std::string_view str);
+
+  // The UTF-16 validation kernels check that every high surrogate is
+  // followed by a low surrogate and vice versa, loading the next unit too.
+#ifdef UNILIB_UTF_SSE2
+  inline static size_t valid_sse2(std::u16string_view str);
+#endif
+#ifdef UNILIB_UTF_AVX2
+  UNILIB_UTF_TARGET_AVX2 inline static size_t valid_avx2(std::u16string_view str);
+#endif
+  inline static size_t valid_simd(std::u16string_view str);
+
+  // The decoding kernels widen a prefix of whole 16-byte ASCII blocks, or of
+  // whole surrogate-free blocks of 8 (SSE2) or 16 (AVX2, AVX-512) UTF-16 units.
+#ifdef UNILIB_UTF_SSE2
+  inline static size_t decode_sse2(std::string_view str, char32_t* decoded);
+  inline static size_t decode_sse2(std::u16string_view str, char32_t* decoded);
+#endif
+#ifdef UNILIB_UTF_AVX2
+  UNILIB_UTF_TARGET_AVX2 inline static size_t decode_avx2(std::string_view str, char32_t* decoded);
+  UNILIB_UTF_TARGET_AVX2 inline static size_t decode_avx2(std::u16string_view str, char32_t* decoded);
+#endif
+#ifdef UNILIB_UTF_AVX512
+  UNILIB_UTF_TARGET_AVX512 inline static size_t decode_avx512(std::string_view str, char32_t* decoded);
+  UNILIB_UTF_TARGET_AVX512 inline static size_t decode_avx512(std::u16string_view str, char32_t* decoded);
+#endif
+  inline static size_t decode_simd(std::string_view str, char32_t* decoded);
+  inline static size_t decode_simd(std::u16string_view str, char32_t* decoded);
+
+  // The analysis kernels process a prefix of whole ASCII blocks (for UTF-8)
+  // or surrogate-free blocks (for UTF-16), updating the largest code point
+  // and adding the UTF-8 length of the processed prefix.
+#ifdef UNILIB_UTF_SSE2
+  inline static size_t analyze_sse2(std::string_view str, char32_t& max_code_point);
+  inline static size_t analyze_sse2(std::u16string_view str, char32_t& max_code_point, size_t& utf8_length);
+#endif
+#ifdef UNILIB_UTF_AVX2
+  UNILIB_UTF_TARGET_AVX2 inline static size_t analyze_avx2(std::u16string_view str, char32_t& max_code_point, size_t& utf8_length);
+#endif
+  inline static size_t analyze_simd(std::string_view str, char32_t& max_code_point);
+  inline static size_t analyze_simd(std::u16string_view str, char32_t& max_code_point, size_t& utf8_length);
+
+  // Decoding of a whole string, appending to `decoded`.
+  template<class Policy> inline static bool decode_append(std::string_view str, std::u32string& decoded);
+  template<class Policy> inline static bool decode_append(std::u16string_view str, std::u32string& decoded);
+
+  // Whether decoding `length` units of `str` produced a replacement of an
+  // invalid sequence, rather than a valid (possibly overlong) '?'.
+  inline static bool replaced(std::string_view str, size_t length, char32_t chr);
+  inline static bool replaced(std::u16string_view str, size_t length, char32_t chr);
+
+  // Writing the output of an error according to the policy, where `invalid`
+  // are the input units of the error and `reserved` is the number of output
+  // units reserved for it; `str` grows if more are needed. Returns false if
+  // the conversion should stop.
+  template<class Policy, class Char, class Input>
+  inline static bool error(std::basic_string<Char>& str, Char*& output, std::basic_string_view<Input> invalid, size_t reserved);
+
+  // Parallel conversion of chunks on code point boundaries, using the serial
+  // method of the given encodings on the chunks.
+  template<class Policy, class Input, class Output, class Executor>
+  inline static bool convert_parallel(std::basic_string_view<Input> str, std::basic_string<Output>& converted, size_t chunk_size, Executor&& run);
+
+  // Length of a sequence cut by the end of the string, or zero.
+  inline static size_t incomplete_suffix(std::string_view str);
+  inline static size_t incomplete_suffix(std::u16string_view str);
+
+  // Decoding of a first code point, distinguishing valid, invalid, and
+  // truncated sequences; `length` is the length of a valid sequence.
+  inline static status_t decode_checked(std::string_view str, char32_t& chr, size_t& length);
+  inline static status_t decode_checked(std::u16string_view str, char32_t& chr, size_t& length);
+
+  // Decoding of a first code point (or a WTF-8 lone surrogate) of a UTF-8
+  // variant, returning the length of its sequence, or zero if it is invalid;
+  // whether the variant can encode a code point; and encoding it.
+  template<utf8_variant_t Variant> inline static size_t decode_variant(std::string_view str, char32_t& chr);
+  template<utf8_variant_t Variant> inline static bool encodable(char32_t chr);
+  template<utf8_variant_t Variant> inline static void append_variant(char*& str, char32_t chr);
+
+  // Length of a prefix of whole 16-byte ASCII blocks, which must not
+  // contain zero bytes in Modified UTF-8.
+  template<utf8_variant_t Variant> inline static size_t ascii_blocks(std::string_view str);
+
+  // The decoding length kernels add the number of code points in the
+  // processed prefix to `length`; the UTF-8 one requires valid input.
+#ifdef UNILIB_UTF_SSE2
+  inline static size_t utf32_length_sse2(std::string_view str, size_t& length);
+  inline static size_t utf32_length_sse2(std::u16string_view str, size_t& length);
+#endif
+#ifdef UNILIB_UTF_AVX2
+  UNILIB_UTF_TARGET_AVX2 inline static size_t utf32_length_avx2(std::string_view str, size_t& length);
+  UNILIB_UTF_TARGET_AVX2 inline static size_t utf32_length_avx2(std::u16string_view str, size_t& length);
+#endif
+  inline static size_t utf32_length_simd(std::string_view str, size_t& length);
+  inline static size_t utf32_length_simd(std::u16string_view str, size_t& length);
+
+  // The truncation kernels process a prefix of whole blocks starting at most
+  // `code_points` code points, which they subtract. The UTF-8 ones count
+  // non-continuation bytes, which is exact only for valid input; the UTF-16
+  // ones read the code unit preceding `str`, which must exist.
+#ifdef UNILIB_UTF_SSE2
+  inline static size_t truncate_sse2(std::string_view str, size_t& code_points);
+  inline static size_t truncate_sse2(std::u16string_view str, size_t& code_points);
+#endif
+#ifdef UNILIB_UTF_AVX2
+  UNILIB_UTF_TARGET_AVX2 inline static size_t truncate_avx2(std::string_view str, size_t& code_points);
+  UNILIB_UTF_TARGET_AVX2 inline static size_t truncate_avx2(std::u16string_view str, size_t& code_points);
+#endif
+  inline static size_t truncate_simd(std::string_view str, size_t& code_points);
+  inline static size_t truncate_simd(std::u16string_view str, size_t& code_points);
+
+  // The encoding length kernels add the length of the encoded prefix to
+  // `length`, and the encoding kernels narrow a prefix of whole blocks of 16
+  // ASCII characters (for UTF-8) or BMP characters (for UTF-16).
+#ifdef UNILIB_UTF_SSE2
+  inline static size_t utf8_length_sse2(std::u32string_view str, size_t& length);
+  inline static size_t utf16_length_sse2(std::u32string_view str, size_t& length);
+  inline static size_t encode_sse2(std::u32string_view str, char* encoded);
+  inline static size_t encode_sse2(std::u32string_view str, char16_t* encoded);
+#endif
+#ifdef UNILIB_UTF_AVX2
+  UNILIB_UTF_TARGET_AVX2 inline static size_t utf8_length_avx2(std::u32string_view str, size_t& length);
+  UNILIB_UTF_TARGET_AVX2 inline static size_t utf16_length_avx2(std::u32string_view str, size_t& length);
+  UNILIB_UTF_TARGET_AVX2 inline static size_t encode_avx2(std::u32string_view str, char* encoded);
+  UNILIB_UTF_TARGET_AVX2 inline static size_t encode_avx2(std::u32string_view str, char16_t* encoded);
+#endif
+#ifdef UNILIB_UTF_AVX512
+  UNILIB_UTF_TARGET_AVX512 inline static size_t utf8_length_avx512(std::u32string_view str, size_t& length);
+  UNILIB_UTF_TARGET_AVX512 inline static size_t utf16_length_avx512(std::u32string_view str, size_t& length);
+  UNILIB_UTF_TARGET_AVX512 inline static size_t encode_avx512(std::u32string_view str, char* encoded);
+  UNILIB_UTF_TARGET_AVX512 inline static size_t encode_avx512(std::u32string_view str, char16_t* encoded);
+#endif
+  inline static size_t encode_simd(std::u32string_view str, char* encoded);
+  inline static size_t encode_simd(std::u32string_view str, char16_t* encoded);
+
+  // The transcoding length kernels process valid UTF-8, or UTF-16 without
+  // surrogates.
+  // The transcoding kernels convert a prefix of 16-unit ASCII blocks.
+#ifdef UNILIB_UTF_SSE2
+  inline static size_t utf8_length_sse2(std::u16string_view str, size_t& length);
+  inline static size_t utf16_length_sse2(std::string_view str, size_t& length);
+  inline static size_t transcode_sse2(std::string_view str, char16_t* transcoded);
+  inline static size_t transcode_sse2(std::u16string_view str, char* transcoded);
+#endif
+#ifdef UNILIB_UTF_AVX2
+  UNILIB_UTF_TARGET_AVX2 inline static size_t utf8_length_avx2(std::u16string_view str, size_t& length);
+  UNILIB_UTF_TARGET_AVX2 inline static size_t utf16_length_avx2(std::string_view str, size_t& length);
+  UNILIB_UTF_TARGET_AVX2 inline static size_t transcode_avx2(std::string_view str, char16_t* transcoded);
+#endif
+  inline static size_t transcode_simd(std::string_view str, char16_t* transcoded);
+  inline static size_t transcode_simd(std::u16string_view str, char* transcoded);
 };
 
 //
@@ -132,6 +592,10 @@ bool utf::valid(const char* str) {
 }
 
 bool utf::valid(std::string_view str) {
+  size_t simd_length = valid_simd(str);
+  if (simd_length == std::string_view::npos) return false;
+  str.remove_prefix(simd_length);
+
   for (; !str.empty(); str.remove_prefix(1))
     if (((unsigned char)str.front()) >= 0x80) {
       if (((unsigned char)str.front()) < 0xC0) return false;
@@ -160,6 +624,10 @@ bool utf::valid(const char16_t* str) {
 }
 
 bool utf::valid(std::u16string_view str) {
+  size_t simd_length = valid_simd(str);
+  if (simd_length == std::u16string_view::npos) return false;
+  str.remove_prefix(simd_length);
+
   for (; !str.empty(); str.remove_prefix(1))
     if (str.front() >= 0xD800 && str.front() < 0xDC00) {
       str.remove_prefix(1); if (str.empty() || str.front() < 0xDC00 || str.front() >= 0xE000) return false;
@@ -181,6 +649,34 @@ bool utf::valid(std::u32string_view str) {
   return true;
 }
 
+// Strict validity, UTF-8
+bool utf::valid_strict(const char* str) {
+  uint64_t state = STRICT_ACCEPT;
+  for (; *str; str++)
+    state = strict_transitions[strict_classes[(unsigned char)*str]] >> (state & 63);
+  return (state & 63) == STRICT_ACCEPT;
+}
+
+bool utf::valid_strict(std::string_view str) {
+  uint64_t state = STRICT_ACCEPT;
+  while (!str.empty()) {
+    // Skip blocks of ASCII characters outside of multi-byte sequences.
+    if ((state & 63) == STRICT_ACCEPT)
+      for (uint64_t block[2]; str.size() >= sizeof(block); str.remove_prefix(sizeof(block))) {
+        memcpy(block, str.data(), sizeof(block));
+        if ((block[0] | block[1]) & 0x8080808080808080ULL) break;
+      }
+
+    // Run the DFA on the next block, checking for errors only at its end.
+    size_t length = str.size() < 16 ? str.size() : 16;
+    for (size_t i = 0; i < length; i++)
+      state = strict_transitions[strict_classes[(unsigned char)str[i]]] >> (state & 63);
+    if ((state & 63) == STRICT_ERROR) return false;
+    str.remove_prefix(length);
+  }
+  return (state & 63) == STRICT_ACCEPT;
+}
+
 // First code point decoding
 char32_t utf::first(const char* str) {
   return decode(str);
@@ -277,29 +773,233 @@ char32_t utf::decode(std::u16string_view& str) {
   return res;
 }
 
+// Last code point decoding
+char32_t utf::last(std::string_view str) {
+  return decode_last(str);
+}
+
+char32_t utf::last(std::u16string_view str) {
+  return decode_last(str);
+}
+
+// Decoding and removing a last code point, UTF-8
+char32_t utf::decode_last(std::string_view& str) {
+  if (str.empty()) return 0;
+
+  // A lead byte always starts a sequence; find the one the last byte can
+  // belong to. If the sequence has more continuation bytes than the lead
+  // byte requires, the last byte is a stray one; if it has fewer, the
+  // sequence is a truncated one, decoded as a single replacement.
+  for (size_t length = 1; length <= 4 && length <= str.size(); length++) {
+    unsigned char chr = str[str.size() - length];
+    if ((chr & 0xC0) == 0x80) continue;
+    if (chr < 0xC0 || chr >= 0xF8) {
+      if (length > 1) break;
+      str.remove_suffix(1);
+      return chr < 0x80 ? chr : REPLACEMENT_CHAR;
+    }
+    if (length > (chr < 0xE0 ? 2U : chr < 0xF0 ? 3U : 4U)) break;
+    std::string_view sequence = str.substr(str.size() - length);
+    str.remove_suffix(length);
+    return decode(sequence);
+  }
+  str.remove_suffix(1);
+  return REPLACEMENT_CHAR;
+}
+
+// Decoding and removing a last code point, UTF-16
+char32_t utf::decode_last(std::u16string_view& str) {
+  if (str.empty()) return 0;
+  char32_t res = str.back();
+  str.remove_suffix(1);
+  if (res < 0xD800 || res >= 0xE000) return res;
+  if (res < 0xDC00 || str.empty() || str.back() < 0xD800 || str.back() >= 0xDC00) return REPLACEMENT_CHAR;
+  res = 0x10000 + ((str.back() - 0xD800) << 10) + (res - 0xDC00);
+  str.remove_suffix(1);
+  return res;
+}
+
+// Code point boundaries, UTF-8
+size_t utf::boundary_before(std::string_view str, size_t offset) {
+  if (offset >= str.size()) return str.size();
+  if ((((unsigned char)str[offset]) & 0xC0) != 0x80) return offset;
+
+  // A continuation byte belongs to a preceding lead byte if it is separated
+  // from it only by fewer continuation bytes than the lead byte requires.
+  for (size_t length = 1; length <= 3 && length <= offset; length++) {
+    unsigned char chr = str[offset - length];
+    if ((chr & 0xC0) == 0x80) continue;
+    if (chr >= 0xC0 && chr < 0xF8 && length < (chr < 0xE0 ? 2U : chr < 0xF0 ? 3U : 4U)) return offset - length;
+    break;
+  }
+  return offset;
+}
+
+size_t utf::boundary_after(std::string_view str, size_t offset) {
+  size_t start = boundary_before(str, offset);
+  if (start == offset) return start;
+  std::string_view rest = str.substr(start);
+  decode(rest);
+  return str.size() - rest.size();
+}
+
+// Code point boundaries, UTF-16
+size_t utf::boundary_before(std::u16string_view str, size_t offset) {
+  if (offset >= str.size()) return str.size();
+  return offset && (str[offset] & 0xFC00) == 0xDC00 && (str[offset - 1] & 0xFC00) == 0xD800 ? offset - 1 : offset;
+}
+
+size_t utf::boundary_after(std::u16string_view str, size_t offset) {
+  size_t start = boundary_before(str, offset);
+  return start == offset || offset >= str.size() ? start : offset + 1;
+}
+
+// Truncation on code point boundaries
+std::string_view utf::truncate(std::string_view str, size_t size) {
+  return str.substr(0, boundary_before(str, size));
+}
+
+std::u16string_view utf::truncate(std::u16string_view str, size_t size) {
+  return str.substr(0, boundary_before(str, size));
+}
+
+std::string_view utf::truncate_code_points(std::string_view str, size_t code_points) {
+  // Count non-continuation bytes, which start the code points of valid UTF-8,
+  // using SIMD for whole blocks; the prefix ends just before the first one
+  // not fitting. If the prefix is not valid, decode it instead.
+  size_t remaining = code_points, length = truncate_simd(str, remaining);
+  for (; length < str.size(); length++)
+    if ((((unsigned char)str[length]) & 0xC0) != 0x80 && !remaining--) break;
+  std::string_view prefix = str.substr(0, length);
+  if (valid(prefix)) return prefix;
+
+  std::string_view rest = str;
+  for (; code_points && !rest.empty(); code_points--) decode(rest);
+  return str.substr(0, str.size() - rest.size());
+}
+
+std::u16string_view utf::truncate_code_points(std::u16string_view str, size_t code_points) {
+  // Every code unit starts a code point, except for a low surrogate preceded
+  // by a high surrogate. The first code unit is processed separately, so
+  // that the SIMD kernels can read the preceding one.
+  if (str.empty() || !code_points) return str.substr(0, 0);
+  size_t remaining = code_points - 1, length = 1 + truncate_simd(str.substr(1), remaining);
+  for (; length < str.size(); length++)
+    if (!((str[length] & 0xFC00) == 0xDC00 && (str[length - 1] & 0xFC00) == 0xD800) && !remaining--) break;
+  return str.substr(0, length);
+}
+
 // Decoding of a whole string
-void utf::decode(const char* str, std::u32string& decoded) {
-  decoded.clear();
-  for (char32_t chr; (chr = decode(str)); )
-    decoded.push_back(chr);
+template<class Policy>
+bool utf::decode(const char* str, std::u32string& decoded) {
+  return decode<Policy>(std::string_view(str), decoded);
 }
 
-void utf::decode(std::string_view str, std::u32string& decoded) {
+template<class Policy>
+bool utf::decode(std::string_view str, std::u32string& decoded) {
   decoded.clear();
-  while (!str.empty())
-    decoded.push_back(decode(str));
+  return decode_append<Policy>(str, decoded);
 }
 
-void utf::decode(const char16_t* str, std::u32string& decoded) {
-  decoded.clear();
-  for (char32_t chr; (chr = decode(str)); )
-    decoded.push_back(chr);
+template<class Policy>
+bool utf::decode(const char16_t* str, std::u32string& decoded) {
+  return decode<Policy>(std::u16string_view(str), decoded);
 }
 
-void utf::decode(std::u16string_view str, std::u32string& decoded) {
+template<class Policy>
+bool utf::decode(std::u16string_view str, std::u32string& decoded) {
   decoded.clear();
-  while (!str.empty())
-    decoded.push_back(decode(str));
+  return decode_append<Policy>(str, decoded);
+}
+
+template<class Policy>
+bool utf::decode_append(std::string_view str, std::u32string& decoded) {
+  // Every code point is decoded from at least one byte.
+  bool valid = true;
+  size_t start = decoded.size();
+  decoded.resize(start + str.size());
+  char32_t* output = decoded.data() + start;
+  while (!str.empty()) {
+    // Widen ASCII blocks, then decode the following block code point by code point.
+    size_t ascii = decode_simd(str, output);
+    output += ascii;
+    str.remove_prefix(ascii);
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; ) {
+      std::string_view sequence = str;
+      char32_t chr = decode(str);
+      if (!replaced(sequence, sequence.size() - str.size(), chr)) { *output++ = chr; continue; }
+      valid = false;
+      sequence.remove_suffix(str.size());
+      if (!error<Policy>(decoded, output, sequence, sequence.size())) str = std::string_view();
+    }
+  }
+  decoded.resize(output - decoded.data());
+  return valid;
+}
+
+template<class Policy>
+bool utf::decode_append(std::u16string_view str, std::u32string& decoded) {
+  // Every code point is decoded from at least one code unit.
+  bool valid = true;
+  size_t start = decoded.size();
+  decoded.resize(start + str.size());
+  char32_t* output = decoded.data() + start;
+  while (!str.empty()) {
+    // Widen surrogate-free blocks, then decode the following block code point by code point.
+    size_t bmp = decode_simd(str, output);
+    output += bmp;
+    str.remove_prefix(bmp);
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; ) {
+      std::u16string_view sequence = str;
+      char32_t chr = decode(str);
+      if (!replaced(sequence, sequence.size() - str.size(), chr)) { *output++ = chr; continue; }
+      valid = false;
+      sequence.remove_suffix(str.size());
+      if (!error<Policy>(decoded, output, sequence, sequence.size())) str = std::u16string_view();
+    }
+  }
+  decoded.resize(output - decoded.data());
+  return valid;
+}
+
+bool utf::replaced(std::string_view str, size_t length, char32_t chr) {
+  if (chr != REPLACEMENT_CHAR) return false;
+  unsigned char lead = str.front();
+  return length != (lead < 0x80 ? 1U : lead < 0xC0 || lead >= 0xF8 ? 0U : lead < 0xE0 ? 2U : lead < 0xF0 ? 3U : 4U);
+}
+
+bool utf::replaced(std::u16string_view str, size_t /*length*/, char32_t chr) {
+  return chr == REPLACEMENT_CHAR && str.front() != REPLACEMENT_CHAR;
+}
+
+template<class Policy, class Char, class Input>
+bool utf::error([[maybe_unused]] std::basic_string<Char>& str, [[maybe_unused]] Char*& output,
+                [[maybe_unused]] std::basic_string_view<Input> invalid, [[maybe_unused]] size_t reserved) {
+  if constexpr (Policy::action == STOP) {
+    return false;
+  } else {
+    // Produce the replacement, at most four code points, into a local buffer.
+    Char replacement[16], *end = replacement;
+    auto produce = [&end](char32_t chr) {
+      if constexpr (std::is_same_v<Char, char32_t>) *end++ = chr;
+      else append(end, chr);
+    };
+    if constexpr (Policy::action == REPLACE) {
+      produce(Policy::replacement);
+    } else if constexpr (Policy::action == PASS_SURROGATES) {
+      if constexpr (std::is_same_v<Input, char>) for (auto&& unit : invalid) produce(0xDC00 + (unsigned char)unit);
+      else if constexpr (std::is_same_v<Input, char16_t>) for (auto&& unit : invalid) produce(unit);
+      else produce(Policy::replacement);
+    }
+
+    if (size_t(end - replacement) > reserved) {
+      size_t offset = output - str.data();
+      str.resize(str.size() + (end - replacement) - reserved);
+      output = str.data() + offset;
+    }
+    for (Char* chr = replacement; chr < end; chr++) *output++ = *chr;
+    return true;
+  }
 }
 
 // Iterator decoding, C-string
@@ -345,24 +1045,32 @@ utf::string_decoder<char16_t> utf::decoder(const char16_t* str) {
 }
 
 // Iterator decoding, string_view
-template<class Char>
-class utf::buffer_decoder<Char>::iterator {
+template<class Char, class Value>
+class utf::view_iterator {
  public:
-  using iterator_category = std::input_iterator_tag;
-  using value_type = char32_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = Value;
   using difference_type = ptrdiff_t;
-  using pointer = char32_t*;
-  using reference = char32_t&;
-  iterator(std::basic_string_view<Char> str) : codepoint(0), next(str) { operator++(); }
-  iterator(const iterator& it) : codepoint(it.codepoint), next(it.next) {}
-  iterator& operator++() { if (!next.empty()) codepoint = decode(next); else next = std::basic_string_view<Char>(); return *this; }
-  iterator operator++(int) { iterator tmp(*this); operator++(); return tmp; }
-  bool operator==(const iterator& other) const { return next.data() == other.next.data(); }
-  bool operator!=(const iterator& other) const { return next.data() != other.next.data(); }
-  char32_t operator*() const { return codepoint; }
+  using pointer = Value*;
+  using reference = Value;
+  view_iterator(std::basic_string_view<Char> str, size_t offset) : codepoint(0), str(str), offset(offset), length(0) { read(); }
+  view_iterator(const view_iterator& it) : codepoint(it.codepoint), str(it.str), offset(it.offset), length(it.length) {}
+  view_iterator& operator=(const view_iterator& it) { codepoint = it.codepoint; str = it.str; offset = it.offset; length = it.length; return *this; }
+  view_iterator& operator++() { offset += length; read(); return *this; }
+  view_iterator operator++(int) { view_iterator tmp(*this); operator++(); return tmp; }
+  view_iterator& operator--() { auto prefix = str.substr(0, offset); codepoint = decode_last(prefix); length = offset - prefix.size(); offset = prefix.size(); return *this; }
+  view_iterator operator--(int) { view_iterator tmp(*this); operator--(); return tmp; }
+  bool operator==(const view_iterator& other) const { return str.data() + offset == other.str.data() + other.offset; }
+  bool operator!=(const view_iterator& other) const { return str.data() + offset != other.str.data() + other.offset; }
+  Value operator*() const {
+    if constexpr (std::is_same_v<Value, decoded_t>) return {codepoint, offset, uint8_t(length)};
+    else return codepoint;
+  }
  private:
+  void read() { auto rest = str.substr(offset); codepoint = decode(rest); length = str.size() - offset - rest.size(); }
   char32_t codepoint;
-  std::basic_string_view<Char> next;
+  std::basic_string_view<Char> str;
+  size_t offset, length;
 };
 
 template<class Char>
@@ -370,12 +1078,22 @@ utf::buffer_decoder<Char>::buffer_decoder(std::basic_string_view<Char> str) : st
 
 template<class Char>
 typename utf::buffer_decoder<Char>::iterator utf::buffer_decoder<Char>::begin() {
-  return iterator(str);
+  return iterator(str, 0);
 }
 
 template<class Char>
 typename utf::buffer_decoder<Char>::iterator utf::buffer_decoder<Char>::end() {
-  return iterator(std::basic_string_view<Char>());
+  return iterator(str, str.size());
+}
+
+template<class Char>
+typename utf::buffer_decoder<Char>::reverse_iterator utf::buffer_decoder<Char>::rbegin() {
+  return reverse_iterator(end());
+}
+
+template<class Char>
+typename utf::buffer_decoder<Char>::reverse_iterator utf::buffer_decoder<Char>::rend() {
+  return reverse_iterator(begin());
 }
 
 utf::buffer_decoder<char> utf::decoder(std::string_view str) {
@@ -386,6 +1104,120 @@ utf::buffer_decoder<char16_t> utf::decoder(std::u16string_view str) {
   return buffer_decoder(str);
 }
 
+// Iterator decoding with offsets
+template<class Char>
+utf::offset_decoder<Char>::offset_decoder(std::basic_string_view<Char> str) : str(str) {}
+
+template<class Char>
+typename utf::offset_decoder<Char>::iterator utf::offset_decoder<Char>::begin() {
+  return iterator(str, 0);
+}
+
+template<class Char>
+typename utf::offset_decoder<Char>::iterator utf::offset_decoder<Char>::end() {
+  return iterator(str, str.size());
+}
+
+utf::offset_decoder<char> utf::offsets(std::string_view str) {
+  return offset_decoder(str);
+}
+
+utf::offset_decoder<char16_t> utf::offsets(std::u16string_view str) {
+  return offset_decoder(str);
+}
+
+// Incremental decoding
+template<class Char, class Policy>
+bool utf::stream_decoder<Char, Policy>::feed(std::basic_string_view<Char> chunk, std::u32string& decoded) {
+  bool valid = true;
+
+  // Complete a pending sequence unit by unit. When a unit ends it without
+  // being a part of it, the unit is returned to the chunk.
+  while (pending_length && !chunk.empty()) {
+    pending[pending_length++] = chunk.front();
+    chunk.remove_prefix(1);
+    std::basic_string_view<Char> sequence(pending, pending_length), rest = sequence;
+    if (incomplete_suffix(sequence) == sequence.size()) continue;
+    decode(rest);
+    chunk = std::basic_string_view<Char>(chunk.data() - rest.size(), chunk.size() + rest.size());
+    pending_length = 0;
+    if (!decode_append<Policy>(sequence.substr(0, sequence.size() - rest.size()), decoded)) {
+      valid = false;
+      if constexpr (Policy::action == STOP) return valid;
+    }
+  }
+  if (pending_length) return valid;
+
+  // Decode the chunk in bulk, except for a sequence cut by its end.
+  size_t incomplete = incomplete_suffix(chunk);
+  if (!decode_append<Policy>(chunk.substr(0, chunk.size() - incomplete), decoded)) {
+    valid = false;
+    if constexpr (Policy::action == STOP) return valid;
+  }
+  for (auto&& chr : chunk.substr(chunk.size() - incomplete))
+    pending[pending_length++] = chr;
+  return valid;
+}
+
+template<class Char, class Policy>
+bool utf::stream_decoder<Char, Policy>::finish(std::u32string& decoded) {
+  bool valid = decode_append<Policy>(std::basic_string_view<Char>(pending, pending_length), decoded);
+  pending_length = 0;
+  return valid;
+}
+
+// Index of offsets
+utf::offset_index::offset_index(std::string_view str, size_t step) : str(str), step(step ? step : 1) {
+  checkpoint_t position = {{0, 0, 0}};
+  checkpoints.push_back(position);
+  while (position.offsets[0] < str.size()) {
+    // Skip ASCII blocks, storing the checkpoints inside them.
+    char32_t max_code_point = 0;
+    size_t ascii = analyze_simd(str.substr(position.offsets[0]), max_code_point);
+    for (size_t next = checkpoints.size() * this->step; next <= position.offsets[2] + ascii; next += this->step) {
+      size_t skip = next - position.offsets[2];
+      checkpoints.push_back({{position.offsets[0] + skip, position.offsets[1] + skip, next}});
+    }
+    for (auto&& offset : position.offsets) offset += ascii;
+
+    // Process the following block code point by code point.
+    for (size_t end = position.offsets[0] + 16; position.offsets[0] < str.size() && position.offsets[0] < end; ) {
+      std::string_view rest = str.substr(position.offsets[0]);
+      char32_t chr = decode(rest);
+      position.offsets[0] = str.size() - rest.size();
+      position.offsets[1] += chr >= 0x10000 && chr <= 0x10FFFF ? 2 : 1;
+      if (++position.offsets[2] % this->step == 0) checkpoints.push_back(position);
+    }
+  }
+  if (position.offsets[2] % this->step) checkpoints.push_back(position);
+}
+
+size_t utf::offset_index::utf8_to_utf16(size_t offset) const { return convert(offset, 0, 1); }
+size_t utf::offset_index::utf8_to_utf32(size_t offset) const { return convert(offset, 0, 2); }
+size_t utf::offset_index::utf16_to_utf8(size_t offset) const { return convert(offset, 1, 0); }
+size_t utf::offset_index::utf16_to_utf32(size_t offset) const { return convert(offset, 1, 2); }
+size_t utf::offset_index::utf32_to_utf8(size_t offset) const { return convert(offset, 2, 0); }
+size_t utf::offset_index::utf32_to_utf16(size_t offset) const { return convert(offset, 2, 1); }
+
+size_t utf::offset_index::convert(size_t offset, unsigned from, unsigned to) const {
+  // Find the last checkpoint not after the offset; the last checkpoint is the
+  // end of the string, even if it is not a multiple of the step.
+  auto checkpoint = from == 2 ? checkpoints.begin() + std::min(offset / step, checkpoints.size() - 1) :
+      std::partition_point(checkpoints.begin(), checkpoints.end(), [&](const checkpoint_t& checkpoint) { return checkpoint.offsets[from] <= offset; }) - 1;
+  checkpoint_t position = *checkpoint;
+
+  // Scan code points while they end before or at the offset.
+  for (std::string_view rest = str.substr(position.offsets[0]); !rest.empty(); ) {
+    std::string_view next = rest;
+    char32_t chr = decode(next);
+    checkpoint_t following = {{str.size() - next.size(), position.offsets[1] + (chr >= 0x10000 && chr <= 0x10FFFF ? 2 : 1), position.offsets[2] + 1}};
+    if (following.offsets[from] > offset) break;
+    position = following;
+    rest = next;
+  }
+  return position.offsets[to];
+}
+
 // Appending a single code point, UTF-8
 void utf::append(char*& str, char32_t chr) {
   if (chr < 0x80) *str++ = chr;
@@ -417,28 +1249,1754 @@ void utf::append(std::u16string& str, char32_t chr) {
 }
 
 // Encoding a whole string
-void utf::encode(const char32_t* str, std::string& encoded) {
-  encoded.clear();
-  while (*str)
-    append(encoded, *str++);
+template<class Policy>
+bool utf::encode(const char32_t* str, std::string& encoded) {
+  return encode<Policy>(std::u32string_view(str), encoded);
 }
 
-void utf::encode(std::u32string_view str, std::string& encoded) {
-  encoded.clear();
-  for (; !str.empty(); str.remove_prefix(1))
-    append(encoded, str.front());
+template<class Policy>
+bool utf::encode(std::u32string_view str, std::string& encoded) {
+  bool valid = true;
+  encoded.resize(utf8_length(str));
+  char* output = encoded.data();
+  while (!str.empty()) {
+    // Narrow ASCII blocks, then encode the following block code point by code point.
+    size_t ascii = encode_simd(str, output);
+    output += ascii;
+    str.remove_prefix(ascii);
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; str.remove_prefix(1)) {
+      if (str.front() < 0x200000) { append(output, str.front()); continue; }
+      valid = false;
+      if (!error<Policy>(encoded, output, str.substr(0, 1), 1)) { str = std::u32string_view(); break; }
+    }
+  }
+  encoded.resize(output - encoded.data());
+  return valid;
 }
 
-void utf::encode(const char32_t* str, std::u16string& encoded) {
-  encoded.clear();
-  while (*str)
-    append(encoded, *str++);
+template<class Policy>
+bool utf::encode(const char32_t* str, std::u16string& encoded) {
+  return encode<Policy>(std::u32string_view(str), encoded);
 }
 
-void utf::encode(std::u32string_view str, std::u16string& encoded) {
-  encoded.clear();
-  for (; !str.empty(); str.remove_prefix(1))
-    append(encoded, str.front());
+template<class Policy>
+bool utf::encode(std::u32string_view str, std::u16string& encoded) {
+  bool valid = true;
+  encoded.resize(utf16_length(str));
+  char16_t* output = encoded.data();
+  while (!str.empty()) {
+    // Narrow BMP blocks, then encode the following block code point by code point.
+    size_t bmp = encode_simd(str, output);
+    output += bmp;
+    str.remove_prefix(bmp);
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; str.remove_prefix(1)) {
+      if (str.front() <= 0x10FFFF) { append(output, str.front()); continue; }
+      valid = false;
+      if (!error<Policy>(encoded, output, str.substr(0, 1), 1)) { str = std::u32string_view(); break; }
+    }
+  }
+  encoded.resize(output - encoded.data());
+  return valid;
+}
+
+// Transcoding a whole string
+template<class Policy>
+bool utf::transcode(const char* str, std::u16string& transcoded) {
+  return transcode<Policy>(std::string_view(str), transcoded);
+}
+
+template<class Policy>
+bool utf::transcode(std::string_view str, std::u16string& transcoded) {
+  bool valid = true;
+  transcoded.resize(utf16_length(str));
+  char16_t* output = transcoded.data();
+  while (!str.empty()) {
+    // Widen ASCII blocks, then transcode the following block code point by code point.
+    size_t ascii = transcode_simd(str, output);
+    output += ascii;
+    str.remove_prefix(ascii);
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; ) {
+      std::string_view sequence = str;
+      char32_t chr = decode(str);
+      if (chr <= 0x10FFFF && !replaced(sequence, sequence.size() - str.size(), chr)) { append(output, chr); continue; }
+      valid = false;
+      sequence.remove_suffix(str.size());
+      if (!error<Policy>(transcoded, output, sequence, 1)) str = std::string_view();
+    }
+  }
+  transcoded.resize(output - transcoded.data());
+  return valid;
+}
+
+template<class Policy>
+bool utf::transcode(const char16_t* str, std::string& transcoded) {
+  return transcode<Policy>(std::u16string_view(str), transcoded);
+}
+
+template<class Policy>
+bool utf::transcode(std::u16string_view str, std::string& transcoded) {
+  bool valid = true;
+  transcoded.resize(utf8_length(str));
+  char* output = transcoded.data();
+  while (!str.empty()) {
+    // Narrow ASCII blocks, then transcode the following block code point by code point.
+    size_t ascii = transcode_simd(str, output);
+    output += ascii;
+    str.remove_prefix(ascii);
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; ) {
+      std::u16string_view sequence = str;
+      char32_t chr = decode(str);
+      if (!replaced(sequence, sequence.size() - str.size(), chr)) { append(output, chr); continue; }
+      valid = false;
+      sequence.remove_suffix(str.size());
+      if (!error<Policy>(transcoded, output, sequence, 1)) str = std::u16string_view();
+    }
+  }
+  transcoded.resize(output - transcoded.data());
+  return valid;
+}
+
+// Variants of UTF-8
+template<utf::utf8_variant_t Variant>
+bool utf::valid(std::string_view str) {
+  while (!str.empty()) {
+    // Skip ASCII blocks, then validate the following block code point by code point.
+    str.remove_prefix(ascii_blocks<Variant>(str));
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; ) {
+      char32_t chr;
+      size_t length = decode_variant<Variant>(str, chr);
+      if (!length) return false;
+      str.remove_prefix(length);
+    }
+  }
+  return true;
+}
+
+template<utf::utf8_variant_t Variant, class Policy>
+bool utf::decode(std::string_view str, std::u32string& decoded) {
+  // Every code point is decoded from at least one byte.
+  bool valid = true;
+  decoded.resize(str.size());
+  char32_t* output = decoded.data();
+  while (!str.empty()) {
+    // Widen ASCII blocks (up to a zero byte in Modified UTF-8), then decode
+    // the following block code point by code point.
+    size_t ascii = decode_simd(str, output);
+    if (Variant == MUTF8) ascii = std::find(output, output + ascii, 0) - output;
+    output += ascii;
+    str.remove_prefix(ascii);
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; ) {
+      char32_t chr;
+      if (size_t length = decode_variant<Variant>(str, chr)) { *output++ = chr; str.remove_prefix(length); continue; }
+      valid = false;
+      std::string_view sequence = str;
+      decode(str);
+      sequence.remove_suffix(str.size());
+      if (!error<Policy>(decoded, output, sequence, sequence.size())) str = std::string_view();
+    }
+  }
+  decoded.resize(output - decoded.data());
+  return valid;
+}
+
+template<utf::utf8_variant_t Variant, class Policy>
+bool utf::encode(std::u32string_view str, std::string& encoded) {
+  // Supplementary code points in CESU-8 and Modified UTF-8 take two more
+  // bytes than in UTF-8, and U+0000 in Modified UTF-8 one more.
+  size_t additional = 0;
+  if (Variant == CESU8 || Variant == MUTF8)
+    for (char32_t chr : str)
+      additional += (chr >= 0x10000 && chr <= 0x10FFFF ? 2 : 0) + (Variant == MUTF8 && !chr ? 1 : 0);
+
+  bool valid = true;
+  encoded.resize(utf8_length(str) + additional);
+  char* output = encoded.data();
+  while (!str.empty()) {
+    // Narrow ASCII blocks (up to a U+0000 in Modified UTF-8), then encode the
+    // following block code point by code point.
+    size_t ascii = encode_simd(str, output);
+    if (Variant == MUTF8) if (auto zero = (char*)memchr(output, 0, ascii)) ascii = zero - output;
+    output += ascii;
+    str.remove_prefix(ascii);
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; str.remove_prefix(1)) {
+      char32_t chr = str.front();
+      if (Variant == WTF8 && chr >= 0xD800 && chr < 0xDC00 && str.size() > 1 && str[1] >= 0xDC00 && str[1] < 0xE000) {
+        append(output, 0x10000 + ((chr - 0xD800) << 10) + (str[1] - 0xDC00));
+        str.remove_prefix(1);
+        continue;
+      }
+      if (encodable<Variant>(chr)) { append_variant<Variant>(output, chr); continue; }
+      valid = false;
+      if (!error<Policy>(encoded, output, str.substr(0, 1), chr < 0x80 ? 1 : chr < 0x800 ? 2 : chr < 0x10000 ? 3 : chr < 0x200000 ? 4 : 1)) {
+        str = std::u32string_view();
+        break;
+      }
+    }
+  }
+  encoded.resize(output - encoded.data());
+  return valid;
+}
+
+template<utf::utf8_variant_t Variant, class Policy>
+bool utf::transcode(std::string_view str, std::u16string& transcoded) {
+  // Every code unit is transcoded from at least one byte.
+  bool valid = true;
+  transcoded.resize(str.size());
+  char16_t* output = transcoded.data();
+  while (!str.empty()) {
+    // Widen ASCII blocks (up to a zero byte in Modified UTF-8), then
+    // transcode the following block code point by code point.
+    size_t ascii = transcode_simd(str, output);
+    if (Variant == MUTF8) ascii = std::find(output, output + ascii, 0) - output;
+    output += ascii;
+    str.remove_prefix(ascii);
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; ) {
+      char32_t chr;
+      if (size_t length = decode_variant<Variant>(str, chr)) {
+        if (chr >= 0xD800 && chr < 0xE000) *output++ = chr;
+        else append(output, chr);
+        str.remove_prefix(length);
+        continue;
+      }
+      valid = false;
+      std::string_view sequence = str;
+      decode(str);
+      sequence.remove_suffix(str.size());
+      if (!error<Policy>(transcoded, output, sequence, sequence.size())) str = std::string_view();
+    }
+  }
+  transcoded.resize(output - transcoded.data());
+  return valid;
+}
+
+template<utf::utf8_variant_t Variant, class Policy>
+bool utf::transcode(std::u16string_view str, std::string& transcoded) {
+  // Surrogate pairs in CESU-8 and Modified UTF-8 take two more bytes than in
+  // UTF-8, and so do WTF-8 lone surrogates (which UTF-8 replaces by one
+  // byte); U+0000 in Modified UTF-8 takes one more.
+  size_t additional = 0;
+  if (Variant != UTF8)
+    for (size_t i = 0; i < str.size(); i++) {
+      if (str[i] >= 0xD800 && str[i] < 0xDC00 && i + 1 < str.size() && str[i + 1] >= 0xDC00 && str[i + 1] < 0xE000) {
+        if (Variant != WTF8) additional += 2;
+        i++;
+      } else if (str[i] >= 0xD800 && str[i] < 0xE000) {
+        if (Variant == WTF8) additional += 2;
+      } else if (Variant == MUTF8 && !str[i]) {
+        additional += 1;
+      }
+    }
+
+  bool valid = true;
+  transcoded.resize(utf8_length(str) + additional);
+  char* output = transcoded.data();
+  while (!str.empty()) {
+    // Narrow ASCII blocks (up to a U+0000 in Modified UTF-8), then transcode
+    // the following block code point by code point.
+    size_t ascii = transcode_simd(str, output);
+    if (Variant == MUTF8) if (auto zero = (char*)memchr(output, 0, ascii)) ascii = zero - output;
+    output += ascii;
+    str.remove_prefix(ascii);
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; ) {
+      char32_t chr;
+      size_t length;
+      if (decode_checked(str, chr, length) == OK) { append_variant<Variant>(output, chr); str.remove_prefix(length); continue; }
+      if (Variant == WTF8) { append(output, str.front()); str.remove_prefix(1); continue; }
+      valid = false;
+      if (!error<Policy>(transcoded, output, str.substr(0, 1), 1)) { str = std::u16string_view(); break; }
+      str.remove_prefix(1);
+    }
+  }
+  transcoded.resize(output - transcoded.data());
+  return valid;
+}
+
+template<utf::utf8_variant_t From, utf::utf8_variant_t To, class Policy>
+bool utf::recode(std::string_view str, std::string& recoded) {
+  // Every sequence is recoded into at most as many bytes, except for 4-byte
+  // sequences becoming surrogate pairs of six bytes in CESU-8 and Modified
+  // UTF-8, and zero bytes becoming two bytes in Modified UTF-8.
+  size_t additional = 0;
+  if (To == CESU8 || To == MUTF8)
+    for (char chr : str)
+      additional += (((unsigned char)chr) >= 0xF0 ? 2 : 0) + (To == MUTF8 && !chr ? 1 : 0);
+
+  bool valid = true;
+  recoded.resize(str.size() + additional);
+  char* output = recoded.data();
+  while (!str.empty()) {
+    // Copy ASCII blocks (without zero bytes if either variant is Modified
+    // UTF-8), then recode the following block code point by code point.
+    size_t ascii = ascii_blocks<From == MUTF8 ? MUTF8 : To>(str);
+    memcpy(output, str.data(), ascii);
+    output += ascii;
+    str.remove_prefix(ascii);
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; ) {
+      char32_t chr;
+      size_t length = decode_variant<From>(str, chr);
+      if (length && encodable<To>(chr)) { append_variant<To>(output, chr); str.remove_prefix(length); continue; }
+      valid = false;
+      std::string_view sequence = str;
+      if (length) str.remove_prefix(length);
+      else decode(str);
+      sequence.remove_suffix(str.size());
+      if (!error<Policy>(recoded, output, sequence, sequence.size())) str = std::string_view();
+    }
+  }
+  recoded.resize(output - recoded.data());
+  return valid;
+}
+
+template<utf::utf8_variant_t Variant>
+size_t utf::decode_variant(std::string_view str, char32_t& chr) {
+  size_t length;
+  if (decode_checked(str, chr, length) != OK) return 0;
+  if (length == 1) return Variant == MUTF8 && !chr ? 0 : 1;
+  if (length == 2) return chr >= 0x80 || (Variant == MUTF8 && !chr) ? 2 : 0;
+  if (length == 4) return (Variant == UTF8 || Variant == WTF8) && chr >= 0x10000 && chr <= 0x10FFFF ? 4 : 0;
+  if (chr < 0x800) return 0;
+  if (chr < 0xD800 || chr >= 0xE000) return 3;
+
+  // Surrogates are valid only in pairs in CESU-8 and Modified UTF-8, and only
+  // alone in WTF-8.
+  if (Variant == UTF8) return 0;
+  char32_t low;
+  bool pair = chr < 0xDC00 && str.size() >= 6 && decode_checked(str.substr(3), low, length) == OK && length == 3 && low >= 0xDC00 && low < 0xE000;
+  if (Variant == WTF8) return pair ? 0 : 3;
+  if (!pair) return 0;
+  chr = 0x10000 + ((chr - 0xD800) << 10) + (low - 0xDC00);
+  return 6;
+}
+
+template<utf::utf8_variant_t Variant>
+bool utf::encodable(char32_t chr) {
+  return chr <= 0x10FFFF && (Variant == WTF8 || chr < 0xD800 || chr >= 0xE000);
+}
+
+template<utf::utf8_variant_t Variant>
+void utf::append_variant(char*& str, char32_t chr) {
+  if (Variant == MUTF8 && !chr) {
+    *str++ = char(0xC0); *str++ = char(0x80);
+  } else if ((Variant == CESU8 || Variant == MUTF8) && chr >= 0x10000) {
+    append(str, 0xD800 + ((chr - 0x10000) >> 10));
+    append(str, 0xDC00 + ((chr - 0x10000) & 0x3FF));
+  } else {
+    append(str, chr);
+  }
+}
+
+template<utf::utf8_variant_t Variant>
+size_t utf::ascii_blocks(std::string_view str) {
+  size_t length = 0;
+  for (uint64_t block[2]; str.size() - length >= sizeof(block); length += sizeof(block)) {
+    memcpy(block, str.data() + length, sizeof(block));
+    if ((block[0] | block[1]) & 0x8080808080808080ULL) break;
+    // In ASCII, subtracting one from every byte sets the top bit only of a zero byte.
+    if (Variant == MUTF8 && ((block[0] - 0x0101010101010101ULL) | (block[1] - 0x0101010101010101ULL)) & 0x8080808080808080ULL) break;
+  }
+  return length;
+}
+
+// Executor running tasks on threads
+utf::thread_executor::thread_executor(unsigned threads) : threads(threads ? threads : 1) {}
+
+template<class Task>
+void utf::thread_executor::operator()(size_t tasks, const Task& task) const {
+  std::atomic<size_t> next(0);
+  auto worker = [&next, tasks, &task] { for (size_t i; (i = next++) < tasks; ) task(i); };
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < threads && i < tasks; i++) workers.emplace_back(worker);
+  worker();
+  for (auto&& thread : workers) thread.join();
+}
+
+// Parallel decoding, encoding, and transcoding of a whole string
+template<class Policy, class Executor>
+bool utf::decode_parallel(std::string_view str, std::u32string& decoded, size_t chunk_size, Executor&& run) {
+  return convert_parallel<Policy>(str, decoded, chunk_size, run);
+}
+
+template<class Policy, class Executor>
+bool utf::decode_parallel(std::u16string_view str, std::u32string& decoded, size_t chunk_size, Executor&& run) {
+  return convert_parallel<Policy>(str, decoded, chunk_size, run);
+}
+
+template<class Policy, class Executor>
+bool utf::encode_parallel(std::u32string_view str, std::string& encoded, size_t chunk_size, Executor&& run) {
+  return convert_parallel<Policy>(str, encoded, chunk_size, run);
+}
+
+template<class Policy, class Executor>
+bool utf::encode_parallel(std::u32string_view str, std::u16string& encoded, size_t chunk_size, Executor&& run) {
+  return convert_parallel<Policy>(str, encoded, chunk_size, run);
+}
+
+template<class Policy, class Executor>
+bool utf::transcode_parallel(std::string_view str, std::u16string& transcoded, size_t chunk_size, Executor&& run) {
+  return convert_parallel<Policy>(str, transcoded, chunk_size, run);
+}
+
+template<class Policy, class Executor>
+bool utf::transcode_parallel(std::u16string_view str, std::string& transcoded, size_t chunk_size, Executor&& run) {
+  return convert_parallel<Policy>(str, transcoded, chunk_size, run);
+}
+
+template<class Policy, class Input, class Output, class Executor>
+bool utf::convert_parallel(std::basic_string_view<Input> str, std::basic_string<Output>& converted, size_t chunk_size, Executor&& run) {
+  // Split the string into chunks on code point boundaries; every code point
+  // is converted independently of the others, also in case of an error.
+  if (!chunk_size) chunk_size = 1;
+  std::vector<size_t> starts(1, 0);
+  for (size_t offset = chunk_size; offset < str.size(); offset += chunk_size) {
+    if constexpr (std::is_same_v<Input, char32_t>) starts.push_back(offset);
+    else if (size_t start = boundary_after(str, offset); start > starts.back()) starts.push_back(start);
+  }
+  starts.push_back(str.size());
+  size_t chunks = starts.size() - 1;
+
+  // Compute the output lengths of the chunks. A valid chunk is converted
+  // later directly into the result; a chunk with errors is converted now
+  // according to the policy, so that its output length is known.
+  std::vector<size_t> offsets(chunks + 1, 0);
+  std::vector<std::basic_string<Output>> invalid(chunks);
+  std::vector<char> valid(chunks, true);
+  run(chunks, [&](size_t i) {
+    auto chunk = str.substr(starts[i], starts[i + 1] - starts[i]);
+    if constexpr (std::is_same_v<Input, char32_t>) {
+      valid[i] = chunk.empty() || *std::max_element(chunk.begin(), chunk.end()) < (std::is_same_v<Output, char> ? 0x200000U : 0x110000U);
+      if (valid[i]) offsets[i + 1] = std::is_same_v<Output, char> ? utf8_length(chunk) : utf16_length(chunk);
+    } else {
+      profile_t profile = analyze(chunk);
+      valid[i] = profile.valid && (!std::is_same_v<Output, char16_t> || profile.max_code_point <= 0x10FFFF);
+      if (valid[i]) offsets[i + 1] = std::is_same_v<Output, char> ? profile.utf8_length : std::is_same_v<Output, char16_t> ? profile.utf16_length : profile.utf32_length;
+    }
+    if (!valid[i]) {
+      if constexpr (std::is_same_v<Output, char32_t>) decode<Policy>(chunk, invalid[i]);
+      else if constexpr (std::is_same_v<Input, char32_t>) encode<Policy>(chunk, invalid[i]);
+      else transcode<Policy>(chunk, invalid[i]);
+      offsets[i + 1] = invalid[i].size();
+    }
+  });
+
+  // Prefix-sum the lengths, dropping the chunks after a stopping error.
+  bool result = true;
+  for (size_t i = 0; i < chunks; i++) {
+    result = result && valid[i];
+    offsets[i + 1] += offsets[i];
+    if (Policy::action == STOP && !valid[i]) { chunks = i + 1; break; }
+  }
+  converted.resize(offsets[chunks]);
+
+  // Convert the valid chunks and copy the others into the result.
+  run(chunks, [&](size_t i) {
+    Output* output = converted.data() + offsets[i];
+    auto chunk = str.substr(starts[i], starts[i + 1] - starts[i]);
+    if (!valid[i]) std::copy(invalid[i].begin(), invalid[i].end(), output);
+    else if constexpr (std::is_same_v<Output, char32_t>) decode_into(chunk, output, offsets[i + 1] - offsets[i]);
+    else if constexpr (std::is_same_v<Input, char32_t>) encode_into(chunk, output, offsets[i + 1] - offsets[i]);
+    else transcode_into(chunk, output, offsets[i + 1] - offsets[i]);
+  });
+  return result;
+}
+
+// Lengths of the decoded, encoded, and transcoded strings
+size_t utf::utf32_length(std::string_view str) {
+  size_t length = 0;
+  if (!valid(str)) {
+    for (; !str.empty(); length++) decode(str);
+    return length;
+  }
+
+  // In valid UTF-8, every byte except for a continuation byte starts a code point.
+  size_t processed = utf32_length_simd(str, length);
+  for (char chr : str.substr(processed))
+    length += (((unsigned char)chr) & 0xC0) != 0x80;
+  return length;
+}
+
+size_t utf::utf32_length(std::u16string_view str) {
+  // Every code unit produces a code point, except for a high surrogate
+  // followed by a low surrogate, which produce one together.
+  size_t length = 0, processed = utf32_length_simd(str, length);
+  for (size_t i = processed; i < str.size(); i++)
+    length += !((str[i] & 0xFC00) == 0xD800 && i + 1 < str.size() && (str[i + 1] & 0xFC00) == 0xDC00);
+  return length;
+}
+
+size_t utf::utf8_length(std::u32string_view str) {
+  size_t length = 0, processed = 0;
+  switch (simd()) {
+#ifdef UNILIB_UTF_AVX512
+    case SIMD_AVX512: processed = utf8_length_avx512(str, length); break;
+#endif
+#ifdef UNILIB_UTF_AVX2
+    case SIMD_AVX2: processed = utf8_length_avx2(str, length); break;
+#endif
+#ifdef UNILIB_UTF_SSE2
+    case SIMD_SSE2: processed = utf8_length_sse2(str, length); break;
+#endif
+    default: break;
+  }
+  for (char32_t chr : str.substr(processed))
+    length += chr < 0x80 ? 1 : chr < 0x800 ? 2 : chr < 0x10000 ? 3 : chr < 0x200000 ? 4 : 1;
+  return length;
+}
+
+size_t utf::utf16_length(std::u32string_view str) {
+  size_t length = 0, processed = 0;
+  switch (simd()) {
+#ifdef UNILIB_UTF_AVX512
+    case SIMD_AVX512: processed = utf16_length_avx512(str, length); break;
+#endif
+#ifdef UNILIB_UTF_AVX2
+    case SIMD_AVX2: processed = utf16_length_avx2(str, length); break;
+#endif
+#ifdef UNILIB_UTF_SSE2
+    case SIMD_SSE2: processed = utf16_length_sse2(str, length); break;
+#endif
+    default: break;
+  }
+  for (char32_t chr : str.substr(processed))
+    length += chr >= 0x10000 && chr <= 0x10FFFF ? 2 : 1;
+  return length;
+}
+
+size_t utf::utf8_length(std::u16string_view str) {
+  size_t length = 0;
+  while (!str.empty()) {
+    size_t processed = 0;
+    switch (simd()) {
+#ifdef UNILIB_UTF_AVX2
+      case SIMD_AVX512:
+      case SIMD_AVX2: processed = utf8_length_avx2(str, length); break;
+#endif
+#ifdef UNILIB_UTF_SSE2
+      case SIMD_SSE2: processed = utf8_length_sse2(str, length); break;
+#endif
+      default: break;
+    }
+    str.remove_prefix(processed);
+
+    // Process the block with surrogates code point by code point.
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; ) {
+      char32_t chr = decode(str);
+      length += chr < 0x80 ? 1 : chr < 0x800 ? 2 : chr < 0x10000 ? 3 : 4;
+    }
+  }
+  return length;
+}
+
+size_t utf::utf16_length(std::string_view str) {
+  size_t length = 0;
+  if (!valid(str)) {
+    while (!str.empty()) {
+      char32_t chr = decode(str);
+      length += chr >= 0x10000 && chr <= 0x10FFFF ? 2 : 1;
+    }
+    return length;
+  }
+
+  // In valid UTF-8, every byte except for a continuation byte produces a code
+  // unit, and 4-byte sequences of code points U+10000-U+10FFFF produce two;
+  // these start with 0xF1-0xF3, 0xF0 followed by at least 0x90, or 0xF4
+  // followed by less than 0x90.
+  while (!str.empty()) {
+    size_t processed = 0;
+    switch (simd()) {
+#ifdef UNILIB_UTF_AVX2
+      case SIMD_AVX512:
+      case SIMD_AVX2: processed = utf16_length_avx2(str, length); break;
+#endif
+#ifdef UNILIB_UTF_SSE2
+      case SIMD_SSE2: processed = utf16_length_sse2(str, length); break;
+#endif
+      default: break;
+    }
+    str.remove_prefix(processed);
+
+    // Skip the rest of a sequence already counted, and process the remaining
+    // block code point by code point.
+    while (!str.empty() && (((unsigned char)str.front()) & 0xC0) == 0x80) str.remove_prefix(1);
+    for (size_t end = str.size() > 16 ? str.size() - 16 : 0; str.size() > end; ) {
+      char32_t chr = decode(str);
+      length += chr >= 0x10000 && chr <= 0x10FFFF ? 2 : 1;
+    }
+  }
+  return length;
+}
+
+// Single-pass analysis
+utf::profile_t utf::analyze(std::string_view str) {
+  profile_t profile = {true, std::string_view::npos, false, 0, 0, 0, 0};
+  for (size_t offset = 0; offset < str.size(); ) {
+    // Skip ASCII blocks, then process the following block code point by code point.
+    size_t ascii = analyze_simd(str.substr(offset), profile.max_code_point);
+    profile.utf8_length += ascii;
+    profile.utf16_length += ascii;
+    profile.utf32_length += ascii;
+    offset += ascii;
+    for (size_t end = offset + 16; offset < str.size() && offset < end; ) {
+      std::string_view sequence = str.substr(offset), rest = sequence;
+      char32_t chr = decode(rest);
+      if (replaced(sequence, sequence.size() - rest.size(), chr) && profile.valid) {
+        profile.valid = false;
+        profile.error_offset = offset;
+      }
+      if (chr > profile.max_code_point) profile.max_code_point = chr;
+      profile.utf8_length += chr < 0x80 ? 1 : chr < 0x800 ? 2 : chr < 0x10000 ? 3 : chr < 0x200000 ? 4 : 1;
+      profile.utf16_length += chr >= 0x10000 && chr <= 0x10FFFF ? 2 : 1;
+      profile.utf32_length++;
+      offset += sequence.size() - rest.size();
+    }
+  }
+  profile.ascii = profile.valid && profile.max_code_point < 0x80;
+  return profile;
+}
+
+utf::profile_t utf::analyze(std::u16string_view str) {
+  // Every code unit is decoded either to a BMP code point or a replacement,
+  // or together with another one to a code point encoded back as a pair.
+  profile_t profile = {true, std::u16string_view::npos, false, 0, 0, str.size(), 0};
+  for (size_t offset = 0; offset < str.size(); ) {
+    // Process surrogate-free blocks, then the following block code point by code point.
+    size_t bmp = analyze_simd(str.substr(offset), profile.max_code_point, profile.utf8_length);
+    profile.utf32_length += bmp;
+    offset += bmp;
+    for (size_t end = offset + 16; offset < str.size() && offset < end; ) {
+      std::u16string_view sequence = str.substr(offset), rest = sequence;
+      char32_t chr = decode(rest);
+      if (replaced(sequence, sequence.size() - rest.size(), chr) && profile.valid) {
+        profile.valid = false;
+        profile.error_offset = offset;
+      }
+      if (chr > profile.max_code_point) profile.max_code_point = chr;
+      profile.utf8_length += chr < 0x80 ? 1 : chr < 0x800 ? 2 : chr < 0x10000 ? 3 : 4;
+      profile.utf32_length++;
+      offset += sequence.size() - rest.size();
+    }
+  }
+  profile.ascii = profile.valid && profile.max_code_point < 0x80;
+  return profile;
+}
+
+// Converting into a caller-provided buffer
+utf::result_t utf::decode_into(std::string_view str, char32_t* decoded, size_t size) {
+  result_t result = {OK, 0, 0};
+  while (result.consumed < str.size()) {
+    // Widen ASCII blocks fitting into the output, then decode the following
+    // block code point by code point.
+    size_t ascii = decode_simd(str.substr(result.consumed, size - result.written), decoded + result.written);
+    result.consumed += ascii;
+    result.written += ascii;
+    for (size_t end = result.consumed + 16; result.consumed < str.size() && result.consumed < end; ) {
+      char32_t chr;
+      size_t length;
+      if ((result.status = decode_checked(str.substr(result.consumed), chr, length)) != OK) return result;
+      if (result.written == size) { result.status = OUTPUT_FULL; return result; }
+      decoded[result.written++] = chr;
+      result.consumed += length;
+    }
+  }
+  return result;
+}
+
+utf::result_t utf::decode_into(std::u16string_view str, char32_t* decoded, size_t size) {
+  result_t result = {OK, 0, 0};
+  while (result.consumed < str.size()) {
+    // Widen surrogate-free blocks fitting into the output, then decode the
+    // following block code point by code point.
+    size_t bmp = decode_simd(str.substr(result.consumed, size - result.written), decoded + result.written);
+    result.consumed += bmp;
+    result.written += bmp;
+    for (size_t end = result.consumed + 16; result.consumed < str.size() && result.consumed < end; ) {
+      char32_t chr;
+      size_t length;
+      if ((result.status = decode_checked(str.substr(result.consumed), chr, length)) != OK) return result;
+      if (result.written == size) { result.status = OUTPUT_FULL; return result; }
+      decoded[result.written++] = chr;
+      result.consumed += length;
+    }
+  }
+  return result;
+}
+
+utf::result_t utf::encode_into(std::u32string_view str, char* encoded, size_t size) {
+  result_t result = {OK, 0, 0};
+  while (result.consumed < str.size()) {
+    // Narrow ASCII blocks fitting into the output, then encode the following
+    // block code point by code point.
+    size_t ascii = encode_simd(str.substr(result.consumed, size - result.written), encoded + result.written);
+    result.consumed += ascii;
+    result.written += ascii;
+    for (size_t end = result.consumed + 16; result.consumed < str.size() && result.consumed < end; result.consumed++) {
+      char32_t chr = str[result.consumed];
+      if (chr >= 0x200000) { result.status = INVALID; return result; }
+      if (size - result.written < (chr < 0x80 ? 1U : chr < 0x800 ? 2U : chr < 0x10000 ? 3U : 4U)) { result.status = OUTPUT_FULL; return result; }
+      char* output = encoded + result.written;
+      append(output, chr);
+      result.written = output - encoded;
+    }
+  }
+  return result;
+}
+
+utf::result_t utf::encode_into(std::u32string_view str, char16_t* encoded, size_t size) {
+  result_t result = {OK, 0, 0};
+  while (result.consumed < str.size()) {
+    // Narrow BMP blocks fitting into the output, then encode the following
+    // block code point by code point.
+    size_t bmp = encode_simd(str.substr(result.consumed, size - result.written), encoded + result.written);
+    result.consumed += bmp;
+    result.written += bmp;
+    for (size_t end = result.consumed + 16; result.consumed < str.size() && result.consumed < end; result.consumed++) {
+      char32_t chr = str[result.consumed];
+      if (chr > 0x10FFFF) { result.status = INVALID; return result; }
+      if (size - result.written < (chr < 0x10000 ? 1U : 2U)) { result.status = OUTPUT_FULL; return result; }
+      char16_t* output = encoded + result.written;
+      append(output, chr);
+      result.written = output - encoded;
+    }
+  }
+  return result;
+}
+
+utf::result_t utf::transcode_into(std::string_view str, char16_t* transcoded, size_t size) {
+  result_t result = {OK, 0, 0};
+  while (result.consumed < str.size()) {
+    // Widen ASCII blocks fitting into the output, then transcode the
+    // following block code point by code point.
+    size_t ascii = transcode_simd(str.substr(result.consumed, size - result.written), transcoded + result.written);
+    result.consumed += ascii;
+    result.written += ascii;
+    for (size_t end = result.consumed + 16; result.consumed < str.size() && result.consumed < end; ) {
+      char32_t chr;
+      size_t length;
+      if ((result.status = decode_checked(str.substr(result.consumed), chr, length)) != OK) return result;
+      if (chr > 0x10FFFF) { result.status = INVALID; return result; }
+      if (size - result.written < (chr < 0x10000 ? 1U : 2U)) { result.status = OUTPUT_FULL; return result; }
+      char16_t* output = transcoded + result.written;
+      append(output, chr);
+      result.written = output - transcoded;
+      result.consumed += length;
+    }
+  }
+  return result;
+}
+
+utf::result_t utf::transcode_into(std::u16string_view str, char* transcoded, size_t size) {
+  result_t result = {OK, 0, 0};
+  while (result.consumed < str.size()) {
+    // Narrow ASCII blocks fitting into the output, then transcode the
+    // following block code point by code point.
+    size_t ascii = transcode_simd(str.substr(result.consumed, size - result.written), transcoded + result.written);
+    result.consumed += ascii;
+    result.written += ascii;
+    for (size_t end = result.consumed + 16; result.consumed < str.size() && result.consumed < end; ) {
+      char32_t chr;
+      size_t length;
+      if ((result.status = decode_checked(str.substr(result.consumed), chr, length)) != OK) return result;
+      if (size - result.written < (chr < 0x80 ? 1U : chr < 0x800 ? 2U : chr < 0x10000 ? 3U : 4U)) { result.status = OUTPUT_FULL; return result; }
+      char* output = transcoded + result.written;
+      append(output, chr);
+      result.written = output - transcoded;
+      result.consumed += length;
+    }
+  }
+  return result;
+}
+
+// Length of a sequence cut by the end of the string
+size_t utf::incomplete_suffix(std::string_view str) {
+  // A lead byte always starts a sequence, which is cut if it is followed by
+  // fewer continuation bytes than it requires.
+  for (size_t length = 1; length <= 3 && length <= str.size(); length++) {
+    unsigned char chr = str[str.size() - length];
+    if (chr < 0x80 || chr >= 0xF8) return 0;
+    if (chr >= 0xC0) return length < (chr < 0xE0 ? 2U : chr < 0xF0 ? 3U : 4U) ? length : 0;
+  }
+  return 0;
+}
+
+size_t utf::incomplete_suffix(std::u16string_view str) {
+  return !str.empty() && str.back() >= 0xD800 && str.back() < 0xDC00;
+}
+
+// Decoding of a first code point with error reporting, UTF-8
+utf::status_t utf::decode_checked(std::string_view str, char32_t& chr, size_t& length) {
+  unsigned char lead = str.front();
+  if (lead < 0x80) { chr = lead; length = 1; return OK; }
+  if (lead < 0xC0 || lead >= 0xF8) return INVALID;
+
+  length = lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+  chr = lead & (0x7F >> length);
+  for (size_t i = 1; i < length; i++) {
+    if (i >= str.size()) return TRUNCATED;
+    if ((((unsigned char)str[i]) & 0xC0) != 0x80) return INVALID;
+    chr = (chr << 6) + (((unsigned char)str[i]) & 0x3F);
+  }
+  return OK;
+}
+
+// Decoding of a first code point with error reporting, UTF-16
+utf::status_t utf::decode_checked(std::u16string_view str, char32_t& chr, size_t& length) {
+  chr = str.front();
+  length = 1;
+  if (chr < 0xD800 || chr >= 0xE000) return OK;
+  if (chr >= 0xDC00) return INVALID;
+  if (str.size() < 2) return TRUNCATED;
+  if (str[1] < 0xDC00 || str[1] >= 0xE000) return INVALID;
+  chr = 0x10000 + ((chr - 0xD800) << 10) + (str[1] - 0xDC00);
+  length = 2;
+  return OK;
+}
+
+// SIMD support
+utf::simd_t utf::simd() {
+#ifdef UNILIB_UTF_SSE2
+  static const simd_t available = [] {
+    simd_t simd = SIMD_SSE2;
+#if defined(UNILIB_UTF_AVX2) && defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] >= 7) {
+      __cpuid(info, 1);
+      bool os_avx = (info[2] & (1 << 27)) && (info[2] & (1 << 28));
+      unsigned long long xcr0 = os_avx ? _xgetbv(0) : 0;
+      __cpuidex(info, 7, 0);
+      if ((xcr0 & 0x06) == 0x06 && (info[1] & (1 << 5))) {
+        simd = SIMD_AVX2;
+        if ((xcr0 & 0xE6) == 0xE6 && (info[1] & (1 << 16)) && (info[1] & (1 << 30))) simd = SIMD_AVX512;
+      }
+    }
+#elif defined(UNILIB_UTF_AVX2)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+      simd = SIMD_AVX2;
+      if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) simd = SIMD_AVX512;
+    }
+#endif
+    return simd;
+  }();
+  return available;
+#else
+  return SIMD_NONE;
+#endif
+}
+
+// SIMD validation, UTF-8
+//
+// Every byte must be a continuation byte exactly if one of the previous three
+// bytes is a lead byte requiring it, and no byte can be 0xF8 or larger. Blocks
+// which (together with the previous block) are pure ASCII are skipped.
+size_t utf::valid_simd(std::string_view str) {
+  size_t length = 0;
+  switch (simd()) {
+#ifdef UNILIB_UTF_AVX512
+    case SIMD_AVX512: length = valid_avx512(str); break;
+#endif
+#ifdef UNILIB_UTF_AVX2
+    case SIMD_AVX2: length = valid_avx2(str); break;
+#endif
+#ifdef UNILIB_UTF_SSE2
+    case SIMD_SSE2: length = valid_sse2(str); break;
+#endif
+    default: break;
+  }
+  if (length == std::string_view::npos) return length;
+
+  // Back up to the lead byte of a sequence possibly crossing the block end.
+  for (size_t back = 1; back <= 3 && back <= length; back++)
+    if (((unsigned char)str[length - back]) >= 0xC0) return length - back;
+    else if (((unsigned char)str[length - back]) < 0x80) break;
+  return length;
+}
+
+#ifdef UNILIB_UTF_SSE2
+size_t utf::valid_sse2(std::string_view str) {
+  const __m128i zero = _mm_setzero_si128(), x80 = _mm_set1_epi8(char(0x80)), xC0 = _mm_set1_epi8(char(0xC0));
+  const __m128i xBF = _mm_set1_epi8(char(0xBF)), xDF = _mm_set1_epi8(char(0xDF)), xEF = _mm_set1_epi8(char(0xEF)), xF7 = _mm_set1_epi8(char(0xF7));
+  __m128i prev = zero, error = zero;
+  size_t i = 0;
+  for (; i + 32 <= str.size(); i += 32) {
+    __m128i blocks[2] = {_mm_loadu_si128((const __m128i*)(str.data() + i)), _mm_loadu_si128((const __m128i*)(str.data() + i + 16))};
+    if (!_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(blocks[0], blocks[1]), prev))) {
+      prev = blocks[1];
+      continue;
+    }
+    for (auto&& block : blocks) {
+      __m128i prev1 = _mm_or_si128(_mm_slli_si128(block, 1), _mm_srli_si128(prev, 15));
+      __m128i prev2 = _mm_or_si128(_mm_slli_si128(block, 2), _mm_srli_si128(prev, 14));
+      __m128i prev3 = _mm_or_si128(_mm_slli_si128(block, 3), _mm_srli_si128(prev, 13));
+      __m128i not_required = _mm_cmpeq_epi8(_mm_or_si128(_mm_or_si128(_mm_subs_epu8(prev1, xBF), _mm_subs_epu8(prev2, xDF)), _mm_subs_epu8(prev3, xEF)), zero);
+      __m128i continuation = _mm_cmpeq_epi8(_mm_and_si128(block, xC0), x80);
+      error = _mm_or_si128(error, _mm_or_si128(_mm_cmpeq_epi8(not_required, continuation), _mm_subs_epu8(block, xF7)));
+      prev = block;
+    }
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, zero)) != 0xFFFF) return std::string_view::npos;
+  }
+  return i;
+}
+#endif
+
+#ifdef UNILIB_UTF_AVX2
+size_t utf::valid_avx2(std::string_view str) {
+  const __m256i zero = _mm256_setzero_si256(), x80 = _mm256_set1_epi8(char(0x80)), xC0 = _mm256_set1_epi8(char(0xC0));
+  const __m256i xBF = _mm256_set1_epi8(char(0xBF)), xDF = _mm256_set1_epi8(char(0xDF)), xEF = _mm256_set1_epi8(char(0xEF)), xF7 = _mm256_set1_epi8(char(0xF7));
+  __m256i prev = zero, error = zero;
+  size_t i = 0;
+  for (; i + 64 <= str.size(); i += 64) {
+    __m256i blocks[2] = {_mm256_loadu_si256((const __m256i*)(str.data() + i)), _mm256_loadu_si256((const __m256i*)(str.data() + i + 32))};
+    if (!_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(blocks[0], blocks[1]), prev))) {
+      prev = blocks[1];
+      continue;
+    }
+    for (auto&& block : blocks) {
+      __m256i shifted = _mm256_permute2x128_si256(prev, block, 0x21);
+      __m256i prev1 = _mm256_alignr_epi8(block, shifted, 15);
+      __m256i prev2 = _mm256_alignr_epi8(block, shifted, 14);
+      __m256i prev3 = _mm256_alignr_epi8(block, shifted, 13);
+      __m256i not_required = _mm256_cmpeq_epi8(_mm256_or_si256(_mm256_or_si256(_mm256_subs_epu8(prev1, xBF), _mm256_subs_epu8(prev2, xDF)), _mm256_subs_epu8(prev3, xEF)), zero);
+      __m256i continuation = _mm256_cmpeq_epi8(_mm256_and_si256(block, xC0), x80);
+      error = _mm256_or_si256(error, _mm256_or_si256(_mm256_cmpeq_epi8(not_required, continuation), _mm256_subs_epu8(block, xF7)));
+      prev = block;
+    }
+    if (!_mm256_testz_si256(error, error)) return std::string_view::npos;
+  }
+  return i;
+}
+#endif
+
+#ifdef UNILIB_UTF_AVX512
+size_t utf::valid_avx512(std::string_view str) {
+  const __m512i zero = _mm512_setzero_si512(), x80 = _mm512_set1_epi8(char(0x80)), xC0 = _mm512_set1_epi8(char(0xC0));
+  const __m512i xBF = _mm512_set1_epi8(char(0xBF)), xDF = _mm512_set1_epi8(char(0xDF)), xEF = _mm512_set1_epi8(char(0xEF)), xF7 = _mm512_set1_epi8(char(0xF7));
+  __m512i prev = zero;
+  size_t i = 0;
+  for (; i + 64 <= str.size(); i += 64) {
+    __m512i block = _mm512_loadu_si512(str.data() + i);
+    if (!_mm512_movepi8_mask(_mm512_or_si512(block, prev))) {
+      prev = block;
+      continue;
+    }
+    __m512i shifted = _mm512_permutex2var_epi64(prev, _mm512_set_epi64(13, 12, 11, 10, 9, 8, 7, 6), block);
+    __m512i prev1 = _mm512_alignr_epi8(block, shifted, 15);
+    __m512i prev2 = _mm512_alignr_epi8(block, shifted, 14);
+    __m512i prev3 = _mm512_alignr_epi8(block, shifted, 13);
+    __m512i required = _mm512_or_si512(_mm512_or_si512(_mm512_subs_epu8(prev1, xBF), _mm512_subs_epu8(prev2, xDF)), _mm512_subs_epu8(prev3, xEF));
+    __mmask64 error = _mm512_test_epi8_mask(required, required) ^ _mm512_cmpeq_epi8_mask(_mm512_and_si512(block, xC0), x80);
+    if (error | _mm512_cmpgt_epu8_mask(block, xF7)) return std::string_view::npos;
+    prev = block;
+  }
+  return i;
+}
+#endif
+
+// SIMD validation, UTF-16
+size_t utf::valid_simd(std::u16string_view str) {
+  size_t length = 0;
+  switch (simd()) {
+#ifdef UNILIB_UTF_AVX2
+    case SIMD_AVX512:
+    case SIMD_AVX2: length = valid_avx2(str); break;
+#endif
+#ifdef UNILIB_UTF_SSE2
+    case SIMD_SSE2: length = valid_sse2(str); break;
+#endif
+    default: break;
+  }
+  if (length == std::u16string_view::npos || !length) return length;
+
+  // The kernels do not check for a low surrogate at the very beginning, and
+  // a high surrogate ending the prefix is left for the scalar code.
+  if ((str[0] & 0xFC00) == 0xDC00) return std::u16string_view::npos;
+  return (str[length - 1] & 0xFC00) == 0xD800 ? length - 1 : length;
+}
+
+#ifdef UNILIB_UTF_SSE2
+size_t utf::valid_sse2(std::u16string_view str) {
+  const __m128i xFC00 = _mm_set1_epi16(short(0xFC00)), xD800 = _mm_set1_epi16(short(0xD800)), xDC00 = _mm_set1_epi16(short(0xDC00));
+  size_t i = 0;
+  for (; i + 9 <= str.size(); i += 8) {
+    __m128i block = _mm_loadu_si128((const __m128i*)(str.data() + i)), next = _mm_loadu_si128((const __m128i*)(str.data() + i + 1));
+    __m128i high = _mm_cmpeq_epi16(_mm_and_si128(block, xFC00), xD800), next_low = _mm_cmpeq_epi16(_mm_and_si128(next, xFC00), xDC00);
+    if (_mm_movemask_epi8(_mm_xor_si128(high, next_low))) return std::u16string_view::npos;
+  }
+  return i;
+}
+#endif
+
+#ifdef UNILIB_UTF_AVX2
+size_t utf::valid_avx2(std::u16string_view str) {
+  const __m256i xFC00 = _mm256_set1_epi16(short(0xFC00)), xD800 = _mm256_set1_epi16(short(0xD800)), xDC00 = _mm256_set1_epi16(short(0xDC00));
+  size_t i = 0;
+  for (; i + 17 <= str.size(); i += 16) {
+    __m256i block = _mm256_loadu_si256((const __m256i*)(str.data() + i)), next = _mm256_loadu_si256((const __m256i*)(str.data() + i + 1));
+    __m256i high = _mm256_cmpeq_epi16(_mm256_and_si256(block, xFC00), xD800), next_low = _mm256_cmpeq_epi16(_mm256_and_si256(next, xFC00), xDC00);
+    if (_mm256_movemask_epi8(_mm256_xor_si256(high, next_low))) return std::u16string_view::npos;
+  }
+  return i;
+}
+#endif
+
+// SIMD decoding, UTF-8
+size_t utf::decode_simd([[maybe_unused]] std::string_view str, [[maybe_unused]] char32_t* decoded) {
+  switch (simd()) {
+#ifdef UNILIB_UTF_AVX512
+    case SIMD_AVX512: return decode_avx512(str, decoded);
+#endif
+#ifdef UNILIB_UTF_AVX2
+    case SIMD_AVX2: return decode_avx2(str, decoded);
+#endif
+#ifdef UNILIB_UTF_SSE2
+    case SIMD_SSE2: return decode_sse2(str, decoded);
+#endif
+    default: return 0;
+  }
+}
+
+#ifdef UNILIB_UTF_SSE2
+size_t utf::decode_sse2(std::string_view str, char32_t* decoded) {
+  const __m128i zero = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i*)(str.data() + i));
+    if (_mm_movemask_epi8(block)) break;
+    __m128i lo = _mm_unpacklo_epi8(block, zero), hi = _mm_unpackhi_epi8(block, zero);
+    _mm_storeu_si128((__m128i*)(decoded + i), _mm_unpacklo_epi16(lo, zero));
+    _mm_storeu_si128((__m128i*)(decoded + i + 4), _mm_unpackhi_epi16(lo, zero));
+    _mm_storeu_si128((__m128i*)(decoded + i + 8), _mm_unpacklo_epi16(hi, zero));
+    _mm_storeu_si128((__m128i*)(decoded + i + 12), _mm_unpackhi_epi16(hi, zero));
+  }
+  return i;
+}
+#endif
+
+#ifdef UNILIB_UTF_AVX2
+size_t utf::decode_avx2(std::string_view str, char32_t* decoded) {
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i*)(str.data() + i));
+    if (_mm_movemask_epi8(block)) break;
+    _mm256_storeu_si256((__m256i*)(decoded + i), _mm256_cvtepu8_epi32(block));
+    _mm256_storeu_si256((__m256i*)(decoded + i + 8), _mm256_cvtepu8_epi32(_mm_unpackhi_epi64(block, block)));
+  }
+  return i;
+}
+#endif
+
+#ifdef UNILIB_UTF_AVX512
+size_t utf::decode_avx512(std::string_view str, char32_t* decoded) {
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i*)(str.data() + i));
+    if (_mm_movemask_epi8(block)) break;
+    _mm512_storeu_si512(decoded + i, _mm512_maskz_cvtepu8_epi32(0xFFFF, block));
+  }
+  return i;
+}
+#endif
+
+// SIMD decoding, UTF-16
+size_t utf::decode_simd([[maybe_unused]] std::u16string_view str, [[maybe_unused]] char32_t* decoded) {
+  switch (simd()) {
+#ifdef UNILIB_UTF_AVX512
+    case SIMD_AVX512: return decode_avx512(str, decoded);
+#endif
+#ifdef UNILIB_UTF_AVX2
+    case SIMD_AVX2: return decode_avx2(str, decoded);
+#endif
+#ifdef UNILIB_UTF_SSE2
+    case SIMD_SSE2: return decode_sse2(str, decoded);
+#endif
+    default: return 0;
+  }
+}
+
+#ifdef UNILIB_UTF_SSE2
+size_t utf::decode_sse2(std::u16string_view str, char32_t* decoded) {
+  const __m128i zero = _mm_setzero_si128(), xF800 = _mm_set1_epi16(short(0xF800)), xD800 = _mm_set1_epi16(short(0xD800));
+  size_t i = 0;
+  for (; i + 8 <= str.size(); i += 8) {
+    __m128i block = _mm_loadu_si128((const __m128i*)(str.data() + i));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(block, xF800), xD800))) break;
+    _mm_storeu_si128((__m128i*)(decoded + i), _mm_unpacklo_epi16(block, zero));
+    _mm_storeu_si128((__m128i*)(decoded + i + 4), _mm_unpackhi_epi16(block, zero));
+  }
+  return i;
+}
+#endif
+
+#ifdef UNILIB_UTF_AVX2
+size_t utf::decode_avx2(std::u16string_view str, char32_t* decoded) {
+  const __m256i xF800 = _mm256_set1_epi16(short(0xF800)), xD800 = _mm256_set1_epi16(short(0xD800));
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m256i block = _mm256_loadu_si256((const __m256i*)(str.data() + i));
+    if (_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(block, xF800), xD800))) break;
+    _mm256_storeu_si256((__m256i*)(decoded + i), _mm256_cvtepu16_epi32(_mm256_castsi256_si128(block)));
+    _mm256_storeu_si256((__m256i*)(decoded + i + 8), _mm256_cvtepu16_epi32(_mm256_extracti128_si256(block, 1)));
+  }
+  return i;
+}
+#endif
+
+#ifdef UNILIB_UTF_AVX512
+size_t utf::decode_avx512(std::u16string_view str, char32_t* decoded) {
+  const __m256i xF800 = _mm256_set1_epi16(short(0xF800)), xD800 = _mm256_set1_epi16(short(0xD800));
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m256i block = _mm256_loadu_si256((const __m256i*)(str.data() + i));
+    if (_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(block, xF800), xD800))) break;
+    _mm512_storeu_si512(decoded + i, _mm512_maskz_cvtepu16_epi32(0xFFFF, block));
+  }
+  return i;
+}
+#endif
+
+// SIMD encoding
+//
+// The length kernels count the additional code units of every code point in
+// 32-bit lanes, which are summed after at most 2^26 iterations to avoid overflow.
+size_t utf::encode_simd([[maybe_unused]] std::u32string_view str, [[maybe_unused]] char* encoded) {
+  switch (simd()) {
+#ifdef UNILIB_UTF_AVX512
+    case SIMD_AVX512: return encode_avx512(str, encoded);
+#endif
+#ifdef UNILIB_UTF_AVX2
+    case SIMD_AVX2: return encode_avx2(str, encoded);
+#endif
+#ifdef UNILIB_UTF_SSE2
+    case SIMD_SSE2: return encode_sse2(str, encoded);
+#endif
+    default: return 0;
+  }
+}
+
+size_t utf::encode_simd([[maybe_unused]] std::u32string_view str, [[maybe_unused]] char16_t* encoded) {
+  switch (simd()) {
+#ifdef UNILIB_UTF_AVX512
+    case SIMD_AVX512: return encode_avx512(str, encoded);
+#endif
+#ifdef UNILIB_UTF_AVX2
+    case SIMD_AVX2: return encode_avx2(str, encoded);
+#endif
+#ifdef UNILIB_UTF_SSE2
+    case SIMD_SSE2: return encode_sse2(str, encoded);
+#endif
+    default: return 0;
+  }
+}
+
+#ifdef UNILIB_UTF_SSE2
+size_t utf::utf8_length_sse2(std::u32string_view str, size_t& length) {
+  const __m128i zero = _mm_setzero_si128();
+  size_t i = 0, blocks = str.size() & ~size_t(3);
+  while (i < blocks) {
+    __m128i additional = zero;
+    for (size_t end = blocks - i > (size_t(4) << 26) ? i + (size_t(4) << 26) : blocks; i < end; i += 4) {
+      __m128i block = _mm_loadu_si128((const __m128i*)(str.data() + i));
+      __m128i below_800 = _mm_cmpeq_epi32(_mm_srli_epi32(block, 11), zero), below_200000 = _mm_cmpeq_epi32(_mm_srli_epi32(block, 21), zero);
+      additional = _mm_add_epi32(additional, _mm_add_epi32(_mm_add_epi32(_mm_cmpeq_epi32(_mm_srli_epi32(block, 7), zero), below_800), _mm_cmpeq_epi32(_mm_srli_epi32(block, 16), zero)));
+      additional = _mm_sub_epi32(additional, _mm_add_epi32(_mm_add_epi32(below_200000, below_200000), below_200000));
+    }
+    uint32_t lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, additional);
+    length += lanes[0] + size_t(lanes[1]) + lanes[2] + lanes[3];
+  }
+  length += blocks;
+  return blocks;
+}
+
+size_t utf::utf16_length_sse2(std::u32string_view str, size_t& length) {
+  const __m128i zero = _mm_setzero_si128(), x11 = _mm_set1_epi32(0x11);
+  size_t i = 0, blocks = str.size() & ~size_t(3);
+  while (i < blocks) {
+    __m128i additional = zero;
+    for (size_t end = blocks - i > (size_t(4) << 26) ? i + (size_t(4) << 26) : blocks; i < end; i += 4) {
+      __m128i plane = _mm_srli_epi32(_mm_loadu_si128((const __m128i*)(str.data() + i)), 16);
+      additional = _mm_sub_epi32(additional, _mm_and_si128(_mm_cmpgt_epi32(plane, zero), _mm_cmpgt_epi32(x11, plane)));
+    }
+    uint32_t lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, additional);
+    length += lanes[0] + size_t(lanes[1]) + lanes[2] + lanes[3];
+  }
+  length += blocks;
+  return blocks;
+}
+
+size_t utf::encode_sse2(std::u32string_view str, char* encoded) {
+  const __m128i non_ascii = _mm_set1_epi32(~0x7F), zero = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m128i b0 = _mm_loadu_si128((const __m128i*)(str.data() + i)), b1 = _mm_loadu_si128((const __m128i*)(str.data() + i + 4));
+    __m128i b2 = _mm_loadu_si128((const __m128i*)(str.data() + i + 8)), b3 = _mm_loadu_si128((const __m128i*)(str.data() + i + 12));
+    __m128i any = _mm_and_si128(_mm_or_si128(_mm_or_si128(b0, b1), _mm_or_si128(b2, b3)), non_ascii);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(any, zero)) != 0xFFFF) break;
+    _mm_storeu_si128((__m128i*)(encoded + i), _mm_packus_epi16(_mm_packs_epi32(b0, b1), _mm_packs_epi32(b2, b3)));
+  }
+  return i;
+}
+
+size_t utf::encode_sse2(std::u32string_view str, char16_t* encoded) {
+  const __m128i non_bmp = _mm_set1_epi32(~0xFFFF), zero = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m128i b0 = _mm_loadu_si128((const __m128i*)(str.data() + i)), b1 = _mm_loadu_si128((const __m128i*)(str.data() + i + 4));
+    __m128i b2 = _mm_loadu_si128((const __m128i*)(str.data() + i + 8)), b3 = _mm_loadu_si128((const __m128i*)(str.data() + i + 12));
+    __m128i any = _mm_and_si128(_mm_or_si128(_mm_or_si128(b0, b1), _mm_or_si128(b2, b3)), non_bmp);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(any, zero)) != 0xFFFF) break;
+    // Sign-extend the lower 16 bits, so that the signed saturation keeps them.
+    b0 = _mm_srai_epi32(_mm_slli_epi32(b0, 16), 16); b1 = _mm_srai_epi32(_mm_slli_epi32(b1, 16), 16);
+    b2 = _mm_srai_epi32(_mm_slli_epi32(b2, 16), 16); b3 = _mm_srai_epi32(_mm_slli_epi32(b3, 16), 16);
+    _mm_storeu_si128((__m128i*)(encoded + i), _mm_packs_epi32(b0, b1));
+    _mm_storeu_si128((__m128i*)(encoded + i + 8), _mm_packs_epi32(b2, b3));
+  }
+  return i;
+}
+#endif
+
+#ifdef UNILIB_UTF_AVX2
+size_t utf::utf8_length_avx2(std::u32string_view str, size_t& length) {
+  const __m256i zero = _mm256_setzero_si256();
+  size_t i = 0, blocks = str.size() & ~size_t(7);
+  while (i < blocks) {
+    __m256i additional = zero;
+    for (size_t end = blocks - i > (size_t(8) << 26) ? i + (size_t(8) << 26) : blocks; i < end; i += 8) {
+      __m256i block = _mm256_loadu_si256((const __m256i*)(str.data() + i));
+      __m256i below_800 = _mm256_cmpeq_epi32(_mm256_srli_epi32(block, 11), zero), below_200000 = _mm256_cmpeq_epi32(_mm256_srli_epi32(block, 21), zero);
+      additional = _mm256_add_epi32(additional, _mm256_add_epi32(_mm256_add_epi32(_mm256_cmpeq_epi32(_mm256_srli_epi32(block, 7), zero), below_800), _mm256_cmpeq_epi32(_mm256_srli_epi32(block, 16), zero)));
+      additional = _mm256_sub_epi32(additional, _mm256_add_epi32(_mm256_add_epi32(below_200000, below_200000), below_200000));
+    }
+    uint32_t lanes[8];
+    _mm256_storeu_si256((__m256i*)lanes, additional);
+    for (auto&& lane : lanes) length += lane;
+  }
+  length += blocks;
+  return blocks;
+}
+
+size_t utf::utf16_length_avx2(std::u32string_view str, size_t& length) {
+  const __m256i zero = _mm256_setzero_si256(), x11 = _mm256_set1_epi32(0x11);
+  size_t i = 0, blocks = str.size() & ~size_t(7);
+  while (i < blocks) {
+    __m256i additional = zero;
+    for (size_t end = blocks - i > (size_t(8) << 26) ? i + (size_t(8) << 26) : blocks; i < end; i += 8) {
+      __m256i plane = _mm256_srli_epi32(_mm256_loadu_si256((const __m256i*)(str.data() + i)), 16);
+      additional = _mm256_sub_epi32(additional, _mm256_and_si256(_mm256_cmpgt_epi32(plane, zero), _mm256_cmpgt_epi32(x11, plane)));
+    }
+    uint32_t lanes[8];
+    _mm256_storeu_si256((__m256i*)lanes, additional);
+    for (auto&& lane : lanes) length += lane;
+  }
+  length += blocks;
+  return blocks;
+}
+
+size_t utf::encode_avx2(std::u32string_view str, char* encoded) {
+  const __m256i non_ascii = _mm256_set1_epi32(~0x7F);
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m256i b0 = _mm256_loadu_si256((const __m256i*)(str.data() + i)), b1 = _mm256_loadu_si256((const __m256i*)(str.data() + i + 8));
+    if (!_mm256_testz_si256(_mm256_or_si256(b0, b1), non_ascii)) break;
+    __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(b0, b1), 0xD8);
+    __m128i bytes = _mm_packus_epi16(_mm256_castsi256_si128(packed), _mm256_extracti128_si256(packed, 1));
+    _mm_storeu_si128((__m128i*)(encoded + i), bytes);
+  }
+  return i;
+}
+
+size_t utf::encode_avx2(std::u32string_view str, char16_t* encoded) {
+  const __m256i non_bmp = _mm256_set1_epi32(~0xFFFF);
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m256i b0 = _mm256_loadu_si256((const __m256i*)(str.data() + i)), b1 = _mm256_loadu_si256((const __m256i*)(str.data() + i + 8));
+    if (!_mm256_testz_si256(_mm256_or_si256(b0, b1), non_bmp)) break;
+    _mm256_storeu_si256((__m256i*)(encoded + i), _mm256_permute4x64_epi64(_mm256_packus_epi32(b0, b1), 0xD8));
+  }
+  return i;
+}
+#endif
+
+#ifdef UNILIB_UTF_AVX512
+size_t utf::utf8_length_avx512(std::u32string_view str, size_t& length) {
+  const __m512i x7F = _mm512_set1_epi32(0x7F), x7FF = _mm512_set1_epi32(0x7FF), xFFFF = _mm512_set1_epi32(0xFFFF), x1FFFFF = _mm512_set1_epi32(0x1FFFFF);
+  const __m512i one = _mm512_set1_epi32(1), three = _mm512_set1_epi32(3);
+  size_t i = 0, blocks = str.size() & ~size_t(15);
+  while (i < blocks) {
+    __m512i additional = _mm512_setzero_si512();
+    for (size_t end = blocks - i > (size_t(16) << 26) ? i + (size_t(16) << 26) : blocks; i < end; i += 16) {
+      __m512i block = _mm512_loadu_si512(str.data() + i);
+      additional = _mm512_mask_add_epi32(additional, _mm512_cmpgt_epu32_mask(block, x7F), additional, one);
+      additional = _mm512_mask_add_epi32(additional, _mm512_cmpgt_epu32_mask(block, x7FF), additional, one);
+      additional = _mm512_mask_add_epi32(additional, _mm512_cmpgt_epu32_mask(block, xFFFF), additional, one);
+      additional = _mm512_mask_sub_epi32(additional, _mm512_cmpgt_epu32_mask(block, x1FFFFF), additional, three);
+    }
+    uint32_t lanes[16];
+    _mm512_storeu_si512(lanes, additional);
+    for (auto&& lane : lanes) length += lane;
+  }
+  length += blocks;
+  return blocks;
+}
+
+size_t utf::utf16_length_avx512(std::u32string_view str, size_t& length) {
+  const __m512i xFFFF = _mm512_set1_epi32(0xFFFF), x10FFFF = _mm512_set1_epi32(0x10FFFF), one = _mm512_set1_epi32(1);
+  size_t i = 0, blocks = str.size() & ~size_t(15);
+  while (i < blocks) {
+    __m512i additional = _mm512_setzero_si512();
+    for (size_t end = blocks - i > (size_t(16) << 26) ? i + (size_t(16) << 26) : blocks; i < end; i += 16) {
+      __m512i block = _mm512_loadu_si512(str.data() + i);
+      additional = _mm512_mask_add_epi32(additional, _mm512_cmpgt_epu32_mask(block, xFFFF) & _mm512_cmple_epu32_mask(block, x10FFFF), additional, one);
+    }
+    uint32_t lanes[16];
+    _mm512_storeu_si512(lanes, additional);
+    for (auto&& lane : lanes) length += lane;
+  }
+  length += blocks;
+  return blocks;
+}
+
+size_t utf::encode_avx512(std::u32string_view str, char* encoded) {
+  const __m512i non_ascii = _mm512_set1_epi32(~0x7F);
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m512i block = _mm512_loadu_si512(str.data() + i);
+    if (_mm512_test_epi32_mask(block, non_ascii)) break;
+    _mm_storeu_si128((__m128i*)(encoded + i), _mm512_maskz_cvtepi32_epi8(0xFFFF, block));
+  }
+  return i;
+}
+
+size_t utf::encode_avx512(std::u32string_view str, char16_t* encoded) {
+  const __m512i non_bmp = _mm512_set1_epi32(~0xFFFF);
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m512i block = _mm512_loadu_si512(str.data() + i);
+    if (_mm512_test_epi32_mask(block, non_bmp)) break;
+    _mm256_storeu_si256((__m256i*)(encoded + i), _mm512_maskz_cvtepi32_epi16(0xFFFF, block));
+  }
+  return i;
+}
+#endif
+
+// SIMD decoding lengths
+size_t utf::utf32_length_simd([[maybe_unused]] std::string_view str, [[maybe_unused]] size_t& length) {
+  switch (simd()) {
+#ifdef UNILIB_UTF_AVX2
+    case SIMD_AVX512:
+    case SIMD_AVX2: return utf32_length_avx2(str, length);
+#endif
+#ifdef UNILIB_UTF_SSE2
+    case SIMD_SSE2: return utf32_length_sse2(str, length);
+#endif
+    default: return 0;
+  }
+}
+
+size_t utf::utf32_length_simd([[maybe_unused]] std::u16string_view str, [[maybe_unused]] size_t& length) {
+  switch (simd()) {
+#ifdef UNILIB_UTF_AVX2
+    case SIMD_AVX512:
+    case SIMD_AVX2: return utf32_length_avx2(str, length);
+#endif
+#ifdef UNILIB_UTF_SSE2
+    case SIMD_SSE2: return utf32_length_sse2(str, length);
+#endif
+    default: return 0;
+  }
+}
+
+// SIMD truncation
+size_t utf::truncate_simd([[maybe_unused]] std::string_view str, [[maybe_unused]] size_t& code_points) {
+  switch (simd()) {
+#ifdef UNILIB_UTF_AVX2
+    case SIMD_AVX512:
+    case SIMD_AVX2: return truncate_avx2(str, code_points);
+#endif
+#ifdef UNILIB_UTF_SSE2
+    case SIMD_SSE2: return truncate_sse2(str, code_points);
+#endif
+    default: return 0;
+  }
+}
+
+size_t utf::truncate_simd([[maybe_unused]] std::u16string_view str, [[maybe_unused]] size_t& code_points) {
+  switch (simd()) {
+#ifdef UNILIB_UTF_AVX2
+    case SIMD_AVX512:
+    case SIMD_AVX2: return truncate_avx2(str, code_points);
+#endif
+#ifdef UNILIB_UTF_SSE2
+    case SIMD_SSE2: return truncate_sse2(str, code_points);
+#endif
+    default: return 0;
+  }
+}
+
+#ifdef UNILIB_UTF_SSE2
+size_t utf::truncate_sse2(std::string_view str, size_t& code_points) {
+  const __m128i zero = _mm_setzero_si128(), xBF = _mm_set1_epi8(char(0xBF));
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i*)(str.data() + i));
+    __m128i sums = _mm_sad_epu8(_mm_sub_epi8(zero, _mm_cmpgt_epi8(block, xBF)), zero);
+    size_t starts = _mm_cvtsi128_si32(sums) + _mm_extract_epi16(sums, 4);
+    if (starts > code_points) break;
+    code_points -= starts;
+  }
+  return i;
+}
+
+size_t utf::truncate_sse2(std::u16string_view str, size_t& code_points) {
+  const __m128i zero = _mm_setzero_si128(), xFC00 = _mm_set1_epi16(short(0xFC00));
+  const __m128i xD800 = _mm_set1_epi16(short(0xD800)), xDC00 = _mm_set1_epi16(short(0xDC00));
+  size_t i = 0;
+  for (; i + 8 <= str.size(); i += 8) {
+    __m128i block = _mm_loadu_si128((const __m128i*)(str.data() + i)), prev = _mm_loadu_si128((const __m128i*)(str.data() + i - 1));
+    __m128i second = _mm_and_si128(_mm_cmpeq_epi16(_mm_and_si128(block, xFC00), xDC00), _mm_cmpeq_epi16(_mm_and_si128(prev, xFC00), xD800));
+    __m128i sums = _mm_sad_epu8(_mm_sub_epi8(zero, second), zero);
+    size_t starts = 8 - (_mm_cvtsi128_si32(sums) + _mm_extract_epi16(sums, 4)) / 2;
+    if (starts > code_points) break;
+    code_points -= starts;
+  }
+  return i;
+}
+#endif
+
+#ifdef UNILIB_UTF_AVX2
+size_t utf::truncate_avx2(std::string_view str, size_t& code_points) {
+  const __m256i zero = _mm256_setzero_si256(), xBF = _mm256_set1_epi8(char(0xBF));
+  size_t i = 0;
+  for (; i + 32 <= str.size(); i += 32) {
+    __m256i block = _mm256_loadu_si256((const __m256i*)(str.data() + i));
+    __m256i sad = _mm256_sad_epu8(_mm256_sub_epi8(zero, _mm256_cmpgt_epi8(block, xBF)), zero);
+    __m128i sums = _mm_add_epi64(_mm256_castsi256_si128(sad), _mm256_extracti128_si256(sad, 1));
+    size_t starts = _mm_cvtsi128_si32(sums) + _mm_extract_epi16(sums, 4);
+    if (starts > code_points) break;
+    code_points -= starts;
+  }
+  return i;
+}
+
+size_t utf::truncate_avx2(std::u16string_view str, size_t& code_points) {
+  const __m256i zero = _mm256_setzero_si256(), xFC00 = _mm256_set1_epi16(short(0xFC00));
+  const __m256i xD800 = _mm256_set1_epi16(short(0xD800)), xDC00 = _mm256_set1_epi16(short(0xDC00));
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m256i block = _mm256_loadu_si256((const __m256i*)(str.data() + i)), prev = _mm256_loadu_si256((const __m256i*)(str.data() + i - 1));
+    __m256i second = _mm256_and_si256(_mm256_cmpeq_epi16(_mm256_and_si256(block, xFC00), xDC00), _mm256_cmpeq_epi16(_mm256_and_si256(prev, xFC00), xD800));
+    __m256i sad = _mm256_sad_epu8(_mm256_sub_epi8(zero, second), zero);
+    __m128i sums = _mm_add_epi64(_mm256_castsi256_si128(sad), _mm256_extracti128_si256(sad, 1));
+    size_t starts = 16 - (_mm_cvtsi128_si32(sums) + _mm_extract_epi16(sums, 4)) / 2;
+    if (starts > code_points) break;
+    code_points -= starts;
+  }
+  return i;
+}
+#endif
+
+#ifdef UNILIB_UTF_SSE2
+size_t utf::utf32_length_sse2(std::string_view str, size_t& length) {
+  const __m128i zero = _mm_setzero_si128(), xBF = _mm_set1_epi8(char(0xBF));
+  __m128i sums = zero;
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i*)(str.data() + i));
+    sums = _mm_add_epi64(sums, _mm_sad_epu8(_mm_sub_epi8(zero, _mm_cmpgt_epi8(block, xBF)), zero));
+  }
+  uint64_t lanes[2];
+  _mm_storeu_si128((__m128i*)lanes, sums);
+  length += lanes[0] + lanes[1];
+  return i;
+}
+
+size_t utf::utf32_length_sse2(std::u16string_view str, size_t& length) {
+  const __m128i zero = _mm_setzero_si128(), one = _mm_set1_epi16(1), xFC00 = _mm_set1_epi16(short(0xFC00));
+  const __m128i xD800 = _mm_set1_epi16(short(0xD800)), xDC00 = _mm_set1_epi16(short(0xDC00));
+  size_t i = 0, pairs = 0;
+  while (i + 9 <= str.size()) {
+    __m128i pair_counts = zero;
+    for (size_t end = str.size() - i > (size_t(8) << 26) ? i + (size_t(8) << 26) : str.size(); i + 9 <= end; i += 8) {
+      __m128i block = _mm_loadu_si128((const __m128i*)(str.data() + i)), next = _mm_loadu_si128((const __m128i*)(str.data() + i + 1));
+      __m128i pair = _mm_and_si128(_mm_cmpeq_epi16(_mm_and_si128(block, xFC00), xD800), _mm_cmpeq_epi16(_mm_and_si128(next, xFC00), xDC00));
+      pair_counts = _mm_sub_epi32(pair_counts, _mm_madd_epi16(pair, one));
+    }
+    uint32_t lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, pair_counts);
+    pairs += lanes[0] + size_t(lanes[1]) + lanes[2] + lanes[3];
+  }
+  length += i - pairs;
+  return i;
+}
+#endif
+
+#ifdef UNILIB_UTF_AVX2
+size_t utf::utf32_length_avx2(std::string_view str, size_t& length) {
+  const __m256i zero = _mm256_setzero_si256(), xBF = _mm256_set1_epi8(char(0xBF));
+  __m256i sums = zero;
+  size_t i = 0;
+  for (; i + 32 <= str.size(); i += 32) {
+    __m256i block = _mm256_loadu_si256((const __m256i*)(str.data() + i));
+    sums = _mm256_add_epi64(sums, _mm256_sad_epu8(_mm256_sub_epi8(zero, _mm256_cmpgt_epi8(block, xBF)), zero));
+  }
+  uint64_t lanes[4];
+  _mm256_storeu_si256((__m256i*)lanes, sums);
+  length += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+  return i;
+}
+
+size_t utf::utf32_length_avx2(std::u16string_view str, size_t& length) {
+  const __m256i zero = _mm256_setzero_si256(), one = _mm256_set1_epi16(1), xFC00 = _mm256_set1_epi16(short(0xFC00));
+  const __m256i xD800 = _mm256_set1_epi16(short(0xD800)), xDC00 = _mm256_set1_epi16(short(0xDC00));
+  size_t i = 0, pairs = 0;
+  while (i + 17 <= str.size()) {
+    __m256i pair_counts = zero;
+    for (size_t end = str.size() - i > (size_t(16) << 26) ? i + (size_t(16) << 26) : str.size(); i + 17 <= end; i += 16) {
+      __m256i block = _mm256_loadu_si256((const __m256i*)(str.data() + i)), next = _mm256_loadu_si256((const __m256i*)(str.data() + i + 1));
+      __m256i pair = _mm256_and_si256(_mm256_cmpeq_epi16(_mm256_and_si256(block, xFC00), xD800), _mm256_cmpeq_epi16(_mm256_and_si256(next, xFC00), xDC00));
+      pair_counts = _mm256_sub_epi32(pair_counts, _mm256_madd_epi16(pair, one));
+    }
+    uint32_t lanes[8];
+    _mm256_storeu_si256((__m256i*)lanes, pair_counts);
+    for (auto&& lane : lanes) pairs += lane;
+  }
+  length += i - pairs;
+  return i;
+}
+#endif
+
+// SIMD analysis
+size_t utf::analyze_simd([[maybe_unused]] std::string_view str, [[maybe_unused]] char32_t& max_code_point) {
+  switch (simd()) {
+#ifdef UNILIB_UTF_SSE2
+    case SIMD_AVX512:
+    case SIMD_AVX2:
+    case SIMD_SSE2: return analyze_sse2(str, max_code_point);
+#endif
+    default: return 0;
+  }
+}
+
+size_t utf::analyze_simd([[maybe_unused]] std::u16string_view str, [[maybe_unused]] char32_t& max_code_point, [[maybe_unused]] size_t& utf8_length) {
+  switch (simd()) {
+#ifdef UNILIB_UTF_AVX2
+    case SIMD_AVX512:
+    case SIMD_AVX2: return analyze_avx2(str, max_code_point, utf8_length);
+#endif
+#ifdef UNILIB_UTF_SSE2
+    case SIMD_SSE2: return analyze_sse2(str, max_code_point, utf8_length);
+#endif
+    default: return 0;
+  }
+}
+
+#ifdef UNILIB_UTF_SSE2
+size_t utf::analyze_sse2(std::string_view str, char32_t& max_code_point) {
+  __m128i maxima = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i*)(str.data() + i));
+    if (_mm_movemask_epi8(block)) break;
+    maxima = _mm_max_epu8(maxima, block);
+  }
+  uint8_t lanes[16];
+  _mm_storeu_si128((__m128i*)lanes, maxima);
+  for (auto&& lane : lanes) if (lane > max_code_point) max_code_point = lane;
+  return i;
+}
+
+size_t utf::analyze_sse2(std::u16string_view str, char32_t& max_code_point, size_t& utf8_length) {
+  // The unsigned maximum is computed as a signed one of values offset by 0x8000.
+  const __m128i zero = _mm_setzero_si128(), one = _mm_set1_epi16(1), x8000 = _mm_set1_epi16(short(0x8000));
+  const __m128i xF800 = _mm_set1_epi16(short(0xF800)), xD800 = _mm_set1_epi16(short(0xD800));
+  __m128i maxima = x8000;
+  size_t i = 0, below = 0;
+  for (bool surrogates = false; !surrogates && i + 8 <= str.size(); ) {
+    __m128i below_counts = zero;
+    for (size_t end = str.size() - i > (size_t(8) << 26) ? i + (size_t(8) << 26) : str.size(); i + 8 <= end; i += 8) {
+      __m128i block = _mm_loadu_si128((const __m128i*)(str.data() + i));
+      if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(block, xF800), xD800))) { surrogates = true; break; }
+      maxima = _mm_max_epi16(maxima, _mm_xor_si128(block, x8000));
+      __m128i below_80_800 = _mm_add_epi16(_mm_cmpeq_epi16(_mm_srli_epi16(block, 7), zero), _mm_cmpeq_epi16(_mm_srli_epi16(block, 11), zero));
+      below_counts = _mm_sub_epi32(below_counts, _mm_madd_epi16(below_80_800, one));
+    }
+    uint32_t lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, below_counts);
+    below += lanes[0] + size_t(lanes[1]) + lanes[2] + lanes[3];
+  }
+  utf8_length += 3 * i - below;
+  uint16_t lanes[8];
+  _mm_storeu_si128((__m128i*)lanes, _mm_xor_si128(maxima, x8000));
+  for (auto&& lane : lanes) if (lane > max_code_point) max_code_point = lane;
+  return i;
+}
+#endif
+
+#ifdef UNILIB_UTF_AVX2
+size_t utf::analyze_avx2(std::u16string_view str, char32_t& max_code_point, size_t& utf8_length) {
+  const __m256i zero = _mm256_setzero_si256(), one = _mm256_set1_epi16(1);
+  const __m256i xF800 = _mm256_set1_epi16(short(0xF800)), xD800 = _mm256_set1_epi16(short(0xD800));
+  __m256i maxima = zero;
+  size_t i = 0, below = 0;
+  for (bool surrogates = false; !surrogates && i + 16 <= str.size(); ) {
+    __m256i below_counts = zero;
+    for (size_t end = str.size() - i > (size_t(16) << 26) ? i + (size_t(16) << 26) : str.size(); i + 16 <= end; i += 16) {
+      __m256i block = _mm256_loadu_si256((const __m256i*)(str.data() + i));
+      if (_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(block, xF800), xD800))) { surrogates = true; break; }
+      maxima = _mm256_max_epu16(maxima, block);
+      __m256i below_80_800 = _mm256_add_epi16(_mm256_cmpeq_epi16(_mm256_srli_epi16(block, 7), zero), _mm256_cmpeq_epi16(_mm256_srli_epi16(block, 11), zero));
+      below_counts = _mm256_sub_epi32(below_counts, _mm256_madd_epi16(below_80_800, one));
+    }
+    uint32_t lanes[8];
+    _mm256_storeu_si256((__m256i*)lanes, below_counts);
+    for (auto&& lane : lanes) below += lane;
+  }
+  utf8_length += 3 * i - below;
+  uint16_t lanes[16];
+  _mm256_storeu_si256((__m256i*)lanes, maxima);
+  for (auto&& lane : lanes) if (lane > max_code_point) max_code_point = lane;
+  return i;
+}
+#endif
+
+// SIMD transcoding
+size_t utf::transcode_simd([[maybe_unused]] std::string_view str, [[maybe_unused]] char16_t* transcoded) {
+  switch (simd()) {
+#ifdef UNILIB_UTF_AVX2
+    case SIMD_AVX512:
+    case SIMD_AVX2: return transcode_avx2(str, transcoded);
+#endif
+#ifdef UNILIB_UTF_SSE2
+    case SIMD_SSE2: return transcode_sse2(str, transcoded);
+#endif
+    default: return 0;
+  }
+}
+
+size_t utf::transcode_simd([[maybe_unused]] std::u16string_view str, [[maybe_unused]] char* transcoded) {
+  switch (simd()) {
+#ifdef UNILIB_UTF_SSE2
+    case SIMD_AVX512:
+    case SIMD_AVX2:
+    case SIMD_SSE2: return transcode_sse2(str, transcoded);
+#endif
+    default: return 0;
+  }
+}
+
+#ifdef UNILIB_UTF_SSE2
+size_t utf::utf8_length_sse2(std::u16string_view str, size_t& length) {
+  const __m128i zero = _mm_setzero_si128(), one = _mm_set1_epi16(1);
+  const __m128i xF800 = _mm_set1_epi16(short(0xF800)), xD800 = _mm_set1_epi16(short(0xD800));
+  size_t i = 0, below = 0;
+  for (bool surrogates = false; !surrogates && i + 8 <= str.size(); ) {
+    __m128i below_counts = zero;
+    for (size_t end = str.size() - i > (size_t(8) << 26) ? i + (size_t(8) << 26) : str.size(); i + 8 <= end; i += 8) {
+      __m128i block = _mm_loadu_si128((const __m128i*)(str.data() + i));
+      if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(block, xF800), xD800))) { surrogates = true; break; }
+      __m128i below_80_800 = _mm_add_epi16(_mm_cmpeq_epi16(_mm_srli_epi16(block, 7), zero), _mm_cmpeq_epi16(_mm_srli_epi16(block, 11), zero));
+      below_counts = _mm_sub_epi32(below_counts, _mm_madd_epi16(below_80_800, one));
+    }
+    uint32_t lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, below_counts);
+    below += lanes[0] + size_t(lanes[1]) + lanes[2] + lanes[3];
+  }
+  length += 3 * i - below;
+  return i;
+}
+
+size_t utf::utf16_length_sse2(std::string_view str, size_t& length) {
+  const __m128i zero = _mm_setzero_si128(), xBF = _mm_set1_epi8(char(0xBF)), x90 = _mm_set1_epi8(char(0x90));
+  const __m128i xF0 = _mm_set1_epi8(char(0xF0)), xF1 = _mm_set1_epi8(char(0xF1)), xF3 = _mm_set1_epi8(char(0xF3)), xF4 = _mm_set1_epi8(char(0xF4));
+  __m128i sums = zero;
+  size_t i = 0;
+  for (; i + 17 <= str.size(); i += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i*)(str.data() + i)), next = _mm_loadu_si128((const __m128i*)(str.data() + i + 1));
+    __m128i next_above_90 = _mm_cmpeq_epi8(_mm_max_epu8(next, x90), next);
+    __m128i surrogates = _mm_or_si128(_mm_and_si128(_mm_cmpeq_epi8(_mm_max_epu8(block, xF1), block), _mm_cmpeq_epi8(_mm_min_epu8(block, xF3), block)),
+                                      _mm_or_si128(_mm_and_si128(_mm_cmpeq_epi8(block, xF0), next_above_90), _mm_andnot_si128(next_above_90, _mm_cmpeq_epi8(block, xF4))));
+    __m128i units = _mm_add_epi8(_mm_cmpgt_epi8(block, xBF), surrogates);
+    sums = _mm_add_epi64(sums, _mm_sad_epu8(_mm_sub_epi8(zero, units), zero));
+  }
+  uint64_t lanes[2];
+  _mm_storeu_si128((__m128i*)lanes, sums);
+  length += lanes[0] + lanes[1];
+  return i;
+}
+
+size_t utf::transcode_sse2(std::string_view str, char16_t* transcoded) {
+  const __m128i zero = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i*)(str.data() + i));
+    if (_mm_movemask_epi8(block)) break;
+    _mm_storeu_si128((__m128i*)(transcoded + i), _mm_unpacklo_epi8(block, zero));
+    _mm_storeu_si128((__m128i*)(transcoded + i + 8), _mm_unpackhi_epi8(block, zero));
+  }
+  return i;
+}
+
+size_t utf::transcode_sse2(std::u16string_view str, char* transcoded) {
+  const __m128i non_ascii = _mm_set1_epi16(short(0xFF80)), zero = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m128i b0 = _mm_loadu_si128((const __m128i*)(str.data() + i)), b1 = _mm_loadu_si128((const __m128i*)(str.data() + i + 8));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(b0, b1), non_ascii), zero)) != 0xFFFF) break;
+    _mm_storeu_si128((__m128i*)(transcoded + i), _mm_packus_epi16(b0, b1));
+  }
+  return i;
+}
+#endif
+
+#ifdef UNILIB_UTF_AVX2
+size_t utf::utf8_length_avx2(std::u16string_view str, size_t& length) {
+  const __m256i zero = _mm256_setzero_si256(), one = _mm256_set1_epi16(1);
+  const __m256i xF800 = _mm256_set1_epi16(short(0xF800)), xD800 = _mm256_set1_epi16(short(0xD800));
+  size_t i = 0, below = 0;
+  for (bool surrogates = false; !surrogates && i + 16 <= str.size(); ) {
+    __m256i below_counts = zero;
+    for (size_t end = str.size() - i > (size_t(16) << 26) ? i + (size_t(16) << 26) : str.size(); i + 16 <= end; i += 16) {
+      __m256i block = _mm256_loadu_si256((const __m256i*)(str.data() + i));
+      if (_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(block, xF800), xD800))) { surrogates = true; break; }
+      __m256i below_80_800 = _mm256_add_epi16(_mm256_cmpeq_epi16(_mm256_srli_epi16(block, 7), zero), _mm256_cmpeq_epi16(_mm256_srli_epi16(block, 11), zero));
+      below_counts = _mm256_sub_epi32(below_counts, _mm256_madd_epi16(below_80_800, one));
+    }
+    uint32_t lanes[8];
+    _mm256_storeu_si256((__m256i*)lanes, below_counts);
+    for (auto&& lane : lanes) below += lane;
+  }
+  length += 3 * i - below;
+  return i;
+}
+
+size_t utf::utf16_length_avx2(std::string_view str, size_t& length) {
+  const __m256i zero = _mm256_setzero_si256(), xBF = _mm256_set1_epi8(char(0xBF)), x90 = _mm256_set1_epi8(char(0x90));
+  const __m256i xF0 = _mm256_set1_epi8(char(0xF0)), xF1 = _mm256_set1_epi8(char(0xF1)), xF3 = _mm256_set1_epi8(char(0xF3)), xF4 = _mm256_set1_epi8(char(0xF4));
+  __m256i sums = zero;
+  size_t i = 0;
+  for (; i + 33 <= str.size(); i += 32) {
+    __m256i block = _mm256_loadu_si256((const __m256i*)(str.data() + i)), next = _mm256_loadu_si256((const __m256i*)(str.data() + i + 1));
+    __m256i next_above_90 = _mm256_cmpeq_epi8(_mm256_max_epu8(next, x90), next);
+    __m256i surrogates = _mm256_or_si256(_mm256_and_si256(_mm256_cmpeq_epi8(_mm256_max_epu8(block, xF1), block), _mm256_cmpeq_epi8(_mm256_min_epu8(block, xF3), block)),
+                                         _mm256_or_si256(_mm256_and_si256(_mm256_cmpeq_epi8(block, xF0), next_above_90), _mm256_andnot_si256(next_above_90, _mm256_cmpeq_epi8(block, xF4))));
+    __m256i units = _mm256_add_epi8(_mm256_cmpgt_epi8(block, xBF), surrogates);
+    sums = _mm256_add_epi64(sums, _mm256_sad_epu8(_mm256_sub_epi8(zero, units), zero));
+  }
+  uint64_t lanes[4];
+  _mm256_storeu_si256((__m256i*)lanes, sums);
+  length += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+  return i;
+}
+
+size_t utf::transcode_avx2(std::string_view str, char16_t* transcoded) {
+  size_t i = 0;
+  for (; i + 16 <= str.size(); i += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i*)(str.data() + i));
+    if (_mm_movemask_epi8(block)) break;
+    _mm256_storeu_si256((__m256i*)(transcoded + i), _mm256_cvtepu8_epi16(block));
+  }
+  return i;
 }
+#endif
 
 } // namespace unilib
@@ -0,0 +1,102 @@
+// This file is part of UniLib <http://github.com/ufal/unilib/>.
+//
+// Copyright 2014 Institute of Formal and Applied Linguistics, Faculty of
+// Mathematics and Physics, Charles University in Prague, Czech Republic.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <chrono>
+#include <iomanip>
+
+#include "test.h"
+
+#include "utf.h"
+using namespace unilib;
+
+// Time of running `function` in nanoseconds per input unit.
+template<class Function>
+double benchmark(size_t units, Function function) {
+  const int repeats = 20;
+  auto start = chrono::steady_clock::now();
+  for (int i = 0; i < repeats; i++) function();
+  chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+  return elapsed.count() * 1e9 / repeats / units;
+}
+
+// Reference scalar conversions, validating and decoding code point by code
+// point like the whole-string methods did before the SIMD kernels.
+void decode_scalar(string_view str, u32string& decoded) {
+  decoded.clear();
+  while (!str.empty())
+    decoded.push_back(utf::decode(str));
+}
+
+void decode_scalar(u16string_view str, u32string& decoded) {
+  decoded.clear();
+  while (!str.empty())
+    decoded.push_back(utf::decode(str));
+}
+
+bool valid_scalar(u16string_view str) {
+  for (; !str.empty(); str.remove_prefix(1))
+    if (str.front() >= 0xD800 && str.front() < 0xDC00) {
+      str.remove_prefix(1); if (str.empty() || str.front() < 0xDC00 || str.front() >= 0xE000) return false;
+    } else if (str.front() >= 0xDC00 && str.front() < 0xE000) return false;
+
+  return true;
+}
+
+// Throughput of decoding 16MB of ASCII and of mostly ASCII UTF-8, and of
+// validating and decoding 16MB of mostly ASCII and of BMP CJK UTF-16, compared
+// to the reference scalar conversions.
+int main(void) {
+  struct corpus { const char* name; string text; } corpora[] = {
+    {"ASCII", "The quick brown fox jumps over the lazy dog, 0123456789 times.\n"},
+    {"Mostly ASCII", "The quick brown fox jumps over the lazy dog, 0123456789 times. "
+        "Fran\xC3\xA7" "ais, espa\xC3\xB1ol, G\xC3\xB6" "del.\n"},
+  };
+
+  cout << fixed << setprecision(2);
+  for (auto&& corpus : corpora) {
+    string text;
+    while (text.size() < (16 << 20)) text.append(corpus.text);
+
+    u32string decoded, reference;
+    utf::decode(text, decoded);
+    decode_scalar(text, reference);
+    if (decoded != reference) return cerr << "The decodings of " << corpus.name << " text differ" << endl, 1;
+
+    double bulk = benchmark(text.size(), [&] { utf::decode(text, decoded); });
+    double scalar = benchmark(text.size(), [&] { decode_scalar(text, decoded); });
+    cout << left << setw(24) << "UTF-8 decode" << setw(14) << corpus.name << bulk << ", scalar " << scalar
+         << " ns per byte (" << scalar / bulk << "x)" << endl;
+  }
+
+  struct u16corpus { const char* name; u16string text; } u16corpora[] = {
+    {"Mostly ASCII", u"The quick brown fox jumps over the lazy dog, 0123456789 times. "
+        u"Fran\u00E7ais, espa\u00F1ol, G\u00F6del.\n"},
+    {"CJK", u"\u4E2D\u6587\u548C\u65E5\u672C\u8A9E\u7684\u6587\u672C\u3002\n"},
+  };
+
+  for (auto&& corpus : u16corpora) {
+    u16string text;
+    while (text.size() * sizeof(char16_t) < (16 << 20)) text.append(corpus.text);
+
+    u32string decoded, reference;
+    utf::decode(text, decoded);
+    decode_scalar(text, reference);
+    if (decoded != reference || !utf::valid(text) || !valid_scalar(text))
+      return cerr << "The conversions of " << corpus.name << " text differ" << endl, 1;
+
+    bool valid = true;
+    double bulk = benchmark(text.size(), [&] { valid &= utf::valid(text); utf::decode(text, decoded); });
+    double scalar = benchmark(text.size(), [&] { valid &= valid_scalar(text); decode_scalar(text, decoded); });
+    if (!valid) return cerr << "The " << corpus.name << " text is not valid" << endl, 1;
+    cout << left << setw(24) << "UTF-16 validate+decode" << setw(14) << corpus.name << bulk << ", scalar " << scalar
+         << " ns per unit (" << scalar / bulk << "x)" << endl;
+  }
+
+  return 0;
+}
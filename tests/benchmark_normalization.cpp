@@ -0,0 +1,197 @@
+// This file is part of UniLib <http://github.com/ufal/unilib/>.
+//
+// Copyright 2014 Institute of Formal and Applied Linguistics, Faculty of
+// Mathematics and Physics, Charles University in Prague, Czech Republic.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <utility>
+
+#include "test.h"
+
+#include "uninorms.h"
+using namespace unilib;
+
+// Time of normalizing a string in nanoseconds per code point.
+template<class Normalize>
+double benchmark(const u32string& str, Normalize normalize) {
+  const int repeats = 20;
+  auto start = chrono::steady_clock::now();
+  for (int i = 0; i < repeats; i++) {
+    u32string normalized = str;
+    normalize(normalized);
+  }
+  chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+  return elapsed.count() * 1e9 / repeats / str.size();
+}
+
+// Reference composition using a binary search in the sorted compositions of
+// every starter, as uninorms::compose did before the perfect hash. The
+// compositions and combining classes are loaded from the UCD.
+class binary_search_composition {
+ public:
+  bool load(const string& data_dir);
+  void compose(u32string& str) const;
+
+ private:
+  enum : char32_t { CHARS = 0x110000 };
+  struct Hangul {
+    enum : char32_t { SBase = 0xAC00, LBase = 0x1100, VBase = 0x1161, TBase = 0x11A7,
+      LCount = 19, VCount = 21, TCount = 28, NCount = VCount * TCount, SCount = LCount * NCount };
+  };
+
+  vector<unsigned char> ccc;
+  vector<uint32_t> composition_index;
+  vector<char32_t> composition_data;
+};
+
+bool binary_search_composition::load(const string& data_dir) {
+  ifstream unicode_data(data_dir + "/UnicodeData.txt"), exclusions(data_dir + "/CompositionExclusions.txt");
+  if (!unicode_data || !exclusions) return false;
+
+  // Canonical decompositions of length two and combining classes.
+  string line;
+  vector<string> parts;
+  vector<pair<char32_t, pair<char32_t, char32_t>>> decompositions;
+  ccc.assign(CHARS, 0);
+  while (getline(unicode_data, line)) {
+    split(line, ';', parts);
+    if (parts.size() != 15) return false;
+    char32_t code = stoi(parts[0], nullptr, 16);
+    ccc[code] = stoi(parts[3]);
+    if (parts[5].empty() || parts[5][0] == '<') continue;
+
+    vector<string> decomposition;
+    split(parts[5], ' ', decomposition);
+    if (decomposition.size() == 2)
+      decompositions.push_back({code, {char32_t(stoi(decomposition[0], nullptr, 16)), char32_t(stoi(decomposition[1], nullptr, 16))}});
+  }
+
+  vector<bool> excluded(CHARS);
+  while (getline(exclusions, line)) {
+    line.erase(min(line.find('#'), line.size()));
+    line.erase(line.find_last_not_of(" \t") + 1);
+    if (!line.empty()) excluded[stoi(line, nullptr, 16)] = true;
+  }
+
+  // Primary compositions of every starter, sorted by the second character.
+  vector<pair<char32_t, pair<char32_t, char32_t>>> compositions;
+  for (auto&& decomposition : decompositions)
+    if (!ccc[decomposition.first] && !ccc[decomposition.second.first] && !excluded[decomposition.first])
+      compositions.push_back({decomposition.second.first, {decomposition.second.second, decomposition.first}});
+  sort(compositions.begin(), compositions.end());
+
+  composition_index.assign(CHARS + 1, 0);
+  composition_data.clear();
+  for (auto&& composition : compositions) {
+    composition_index[composition.first + 1] += 2;
+    composition_data.push_back(composition.second.first);
+    composition_data.push_back(composition.second.second);
+  }
+  for (char32_t chr = 0; chr < CHARS; chr++)
+    composition_index[chr + 1] += composition_index[chr];
+
+  return true;
+}
+
+void binary_search_composition::compose(u32string& str) const {
+  size_t old, com;
+  for (old = 0, com = 0; old < str.size(); old++, com++) {
+    str[com] = str[old];
+    if (str[old] >= Hangul::LBase && str[old] < Hangul::LBase + Hangul::LCount) {
+      // Check Hangul composition L + V [+ T].
+      if (old + 1 < str.size() && str[old + 1] >= Hangul::VBase && str[old + 1] < Hangul::VBase + Hangul::VCount) {
+        str[com] = Hangul::SBase + ((str[old] - Hangul::LBase) * Hangul::VCount + str[old + 1] - Hangul::VBase) * Hangul::TCount;
+        old++;
+        if (old + 1 < str.size() && str[old + 1] > Hangul::TBase && str[old + 1] < Hangul::TBase + Hangul::TCount)
+          str[com] += str[++old] - Hangul::TBase;
+      }
+    } else if (str[old] >= Hangul::SBase && str[old] < Hangul::SBase + Hangul::SCount) {
+      // Check Hangul composition LV + T
+      if ((str[old] - Hangul::SBase) % Hangul::TCount && old + 1 < str.size() && str[old + 1] > Hangul::TBase && str[old + 1] < Hangul::TBase + Hangul::TCount)
+        str[com] += str[++old] - Hangul::TBase;
+    } else if (str[old] < CHARS) {
+      // Check composition_data
+      auto composition = &composition_index[str[old]];
+      auto starter = com;
+      for (int last_ccc = -1; old + 1 < str.size(); old++) {
+        int ccc = str[old + 1] < CHARS ? this->ccc[str[old + 1]] : 0;
+        if (composition[1] - composition[0] && last_ccc < ccc) {
+          // Try finding a composition.
+          auto l = composition[0], r = composition[1];
+          while (l + 2 < r) {
+            auto m = l + (((r - l) >> 1) & ~1);
+            if (composition_data[m] <= str[old + 1]) l = m;
+            if (composition_data[m] >= str[old + 1]) r = m;
+          }
+          if (composition_data[l] == str[old + 1]) {
+            // Found a composition.
+            str[starter] = composition_data[l + 1];
+            composition = &composition_index[composition_data[l + 1]];
+            continue;
+          }
+        }
+
+        if (!ccc) break;
+        last_ccc = ccc;
+        str[++com] = str[old + 1];
+      }
+    }
+  }
+
+  if (com < old) str.resize(com);
+}
+
+// Throughput of decomposing Vietnamese, Greek, and Latin text, and of
+// composing it back, which composes nearly every letter with a diacritic.
+// The composition is compared to the reference binary search composition,
+// run after a decomposition doing the same work as the one in uninorms::nfc.
+int main(int argc, char* argv[]) {
+  if (argc < 2) return cerr << "Usage: " << argv[0] << " ucd_data_directory" << endl, 1;
+
+  binary_search_composition reference;
+  if (!reference.load(argv[1])) return cerr << "Cannot load UCD data from " << argv[1] << endl, 1;
+
+  struct corpus { const char* name; u32string text; } corpora[] = {
+    {"Vietnamese", U"Ti\u1EBFng Vi\u1EC7t l\u00E0 ng\u00F4n ng\u1EEF c\u1EE7a ng\u01B0\u1EDDi Vi\u1EC7t v\u00E0 l\u00E0 ng\u00F4n ng\u1EEF ch\u00EDnh th\u1EE9c t\u1EA1i Vi\u1EC7t Nam. "},
+    {"Greek", U"\u0397 \u03B5\u03BB\u03BB\u03B7\u03BD\u03B9\u03BA\u03AE \u03B3\u03BB\u03CE\u03C3\u03C3\u03B1 \u03B1\u03BD\u03AE\u03BA\u03B5\u03B9 \u03C3\u03C4\u03B7\u03BD "
+        U"\u03B9\u03BD\u03B4\u03BF\u03B5\u03C5\u03C1\u03C9\u03C0\u03B1\u03CA\u03BA\u03AE \u03BF\u03B9\u03BA\u03BF\u03B3\u03AD\u03BD\u03B5\u03B9\u03B1. "
+        U"\u1F08\u03C1\u03C7\u1F74 \u03C3\u03BF\u03C6\u03AF\u03B1\u03C2 \u1F41 \u03C6\u03CC\u03B2\u03BF\u03C2. "},
+    {"Latin", U"P\u0159\u00EDli\u0161 \u017Elu\u0165ou\u010Dk\u00FD k\u016F\u0148 \u00FAp\u011Bl \u010F\u00E1belsk\u00E9 \u00F3dy. "
+        U"Fran\u00E7ais, espa\u00F1ol, portugu\u00EAs, G\u00F6del. "},
+  };
+
+  auto nfc = [](u32string& str) { uninorms::nfc(str); };
+  auto nfd_binary_search_composition = [&reference](u32string& str) { uninorms::nfd(str); reference.compose(str); };
+
+  for (auto&& corpus : corpora) {
+    // The decomposed text starts with a precomposed letter, so that the
+    // reference path decomposes the whole text too, like uninorms::nfc.
+    u32string composed(U"\u00E9"), decomposed;
+    while (composed.size() < (1 << 20)) composed.append(corpus.text);
+    decomposed = composed;
+    uninorms::nfd(decomposed);
+    decomposed.replace(0, 2, U"\u00E9");
+
+    u32string normalized = decomposed, reference_normalized = decomposed;
+    nfc(normalized);
+    nfd_binary_search_composition(reference_normalized);
+    if (normalized != composed || reference_normalized != composed)
+      return cerr << "The compositions of " << corpus.name << " text differ" << endl, 1;
+
+    cout << left << setw(12) << corpus.name << fixed << setprecision(2)
+         << "NFD " << benchmark(composed, [](u32string& str) { uninorms::nfd(str); })
+         << ", NFKD " << benchmark(composed, [](u32string& str) { uninorms::nfkd(str); })
+         << ", NFC " << benchmark(decomposed, nfc)
+         << ", NFC with binary search " << benchmark(decomposed, nfd_binary_search_composition)
+         << " ns per code point" << endl;
+  }
+
+  return 0;
+}
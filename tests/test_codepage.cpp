@@ -0,0 +1,108 @@
+// This file is part of UniLib <http://github.com/ufal/unilib/>.
+//
+// Copyright 2014 Institute of Formal and Applied Linguistics, Faculty of
+// Mathematics and Physics, Charles University in Prague, Czech Republic.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <random>
+
+#include "test.h"
+
+#include "codepage.h"
+#include "utf.h"
+
+using namespace unilib;
+
+int main(void) {
+  codepage::encoding_t encodings[] = {codepage::ASCII, codepage::LATIN1, codepage::CP1252};
+
+  // Single characters
+  test([](char chr) { return codepage::decode(codepage::CP1252, chr); }, '\x80', char32_t(0x20AC));
+  test([](char chr) { return codepage::decode(codepage::CP1252, chr); }, '\x9F', char32_t(0x178));
+  test([](char chr) { return codepage::decode(codepage::CP1252, chr); }, '\x81', char32_t(0x81));
+  test([](char chr) { return codepage::decode(codepage::CP1252, chr); }, '\xE9', char32_t(0xE9));
+  test([](char chr) { return codepage::decode(codepage::LATIN1, chr); }, '\x80', char32_t(0x80));
+  test([](char chr) { return codepage::decode(codepage::ASCII, chr); }, '\xE9', char32_t('?'));
+  test([](char32_t chr) { char encoded; return codepage::encode(codepage::CP1252, chr, encoded) ? string(1, encoded) : string(); }, char32_t(0x2122), string("\x99"));
+  test([](char32_t chr) { char encoded; return codepage::encode(codepage::CP1252, chr, encoded) ? string(1, encoded) : string(); }, char32_t(0x80), string());
+  test([](char32_t chr) { char encoded; return codepage::encode(codepage::LATIN1, chr, encoded) ? string(1, encoded) : string(); }, char32_t(0x80), string("\x80"));
+  test([](char32_t chr) { char encoded; return codepage::encode(codepage::LATIN1, chr, encoded) ? string(1, encoded) : string(); }, char32_t(0x100), string());
+  test([](char32_t chr) { char encoded; return codepage::encode(codepage::ASCII, chr, encoded) ? string(1, encoded) : string(); }, char32_t(0x80), string());
+
+  // All bytes are decoded and encoded back, except for the upper half of
+  // ASCII, which is decoded and encoded back as '?'.
+  for (auto&& encoding : encodings)
+    for (unsigned byte = 0; byte < 256; byte++) {
+      char32_t chr = codepage::decode(encoding, char(byte));
+      char encoded;
+      test([encoding, &encoded](char32_t chr) { return codepage::encode(encoding, chr, encoded); }, chr, true);
+      test([](char encoded) { return unsigned((unsigned char)encoded); }, encoded, encoding != codepage::ASCII || byte < 0x80 ? byte : unsigned('?'));
+    }
+
+  // Whole strings
+  test([](const string& str) { string res; codepage::decode(codepage::CP1252, str, res); return res; }, string("caf\xE9 \x80 \x93x\x94"), string("caf\xC3\xA9 \xE2\x82\xAC \xE2\x80\x9Cx\xE2\x80\x9D"));
+  test([](const string& str) { string res; codepage::encode(codepage::CP1252, string_view(str), res); return res; }, string("caf\xC3\xA9 \xE2\x82\xAC \xE2\x80\x9Cx\xE2\x80\x9D"), string("caf\xE9 \x80 \x93x\x94"));
+  test([](const string& str) { string res; return codepage::encode(codepage::LATIN1, string_view(str), res) ? res : string("error"); }, string("\xE2\x82\xAC"), string("error"));
+  test([](const string& str) { return codepage::fits(codepage::LATIN1, string_view(str)); }, string("caf\xC3\xA9"), true);
+  test([](const string& str) { return codepage::fits(codepage::LATIN1, string_view(str)); }, string("\xE2\x82\xAC"), false);
+  test([](const string& str) { return codepage::fits(codepage::CP1252, string_view(str)); }, string("\xE2\x82\xAC"), true);
+  test([](const string& str) { return codepage::fits(codepage::CP1252, string_view(str)); }, string("\xC2\x80"), false);
+  test([](const string& str) { return codepage::fits(codepage::LATIN1, string_view(str)); }, string("\xC3"), false);
+  test([](const string& str) { string res; return codepage::encode(codepage::LATIN1, string_view(str), res) ? res : res + " error"; }, string("a\xC3"), string("a? error"));
+  test([](const u16string& str) { string res; return codepage::encode(codepage::LATIN1, u16string_view(str), res) ? res : res + " error"; }, u16string(u"a\xD800"), string("a? error"));
+
+  // Decoding of random byte strings long enough to exercise the SIMD paths,
+  // checked against decoding byte by byte, and encoding them back.
+  mt19937 generator(42);
+  for (int i = 0; i < 30000; i++)
+    for (auto&& encoding : encodings) {
+      string str;
+      for (size_t length = generator() % 300; str.size() < length; )
+        if (generator() % 4) str.append(generator() % 40, char(generator() % (generator() % 2 ? 0x80 : 0x100)));
+        else str.push_back(char(generator()));
+      u32string decoded;
+      for (auto&& chr : str) decoded.push_back(codepage::decode(encoding, chr));
+      string decoded8; utf::encode(decoded, decoded8);
+      u16string decoded16; utf::encode(decoded, decoded16);
+      string expected;
+      for (auto&& chr : decoded) { char encoded; codepage::encode(encoding, chr, encoded); expected.push_back(encoded); }
+
+      test([encoding](const string& str) { u32string res; codepage::decode(encoding, str, res); return res; }, str, decoded);
+      test([encoding](const string& str) { u16string res; codepage::decode(encoding, str, res); return res; }, str, decoded16);
+      test([encoding](const string& str) { string res; codepage::decode(encoding, str, res); return res; }, str, decoded8);
+      test([encoding](const string& str) { return codepage::utf8_length(encoding, str); }, str, decoded8.size());
+      test([encoding](const u32string& str) { string res; codepage::encode(encoding, u32string_view(str), res); return res; }, decoded, expected);
+      test([encoding](const u16string& str) { string res; codepage::encode(encoding, u16string_view(str), res); return res; }, decoded16, expected);
+      test([encoding](const string& str) { string res; codepage::encode(encoding, string_view(str), res); return res; }, decoded8, expected);
+      if (encoding != codepage::ASCII) test([](const string& str) { return str; }, expected, str);
+      test([encoding](const string& str) { return codepage::fits(encoding, string_view(str)); }, decoded8, true);
+    }
+
+  // Encoding of random strings with code points in and out of the encodings
+  // (but no surrogates), checked against encoding code point by code point.
+  for (int i = 0; i < 30000; i++)
+    for (auto&& encoding : encodings) {
+      u32string str;
+      for (size_t length = generator() % 300; str.size() < length; )
+        if (generator() % 4) str.append(generator() % 40, char32_t(generator() % (generator() % 2 ? 0x80 : 0x100)));
+        else if (generator() % 2) str.push_back(codepage::decode(codepage::CP1252, char(0x80 + generator() % 32)));
+        else if (char32_t chr = generator() % 0x110000; chr < 0xD800 || chr >= 0xE000) str.push_back(chr);
+      string expected;
+      bool fits = true;
+      for (auto&& chr : str) { char encoded; fits &= codepage::encode(encoding, chr, encoded); expected.push_back(encoded); }
+      string str8; utf::encode(str, str8);
+      u16string str16; utf::encode(str, str16);
+
+      test([encoding](const u32string& str) { string res; bool fits = codepage::encode(encoding, u32string_view(str), res); return res + char('0' + fits); }, str, expected + char('0' + fits));
+      test([encoding](const u16string& str) { string res; bool fits = codepage::encode(encoding, u16string_view(str), res); return res + char('0' + fits); }, str16, expected + char('0' + fits));
+      test([encoding](const string& str) { string res; bool fits = codepage::encode(encoding, string_view(str), res); return res + char('0' + fits); }, str8, expected + char('0' + fits));
+      test([encoding](const u32string& str) { return codepage::fits(encoding, u32string_view(str)); }, str, fits);
+      test([encoding](const u16string& str) { return codepage::fits(encoding, u16string_view(str)); }, str16, fits);
+      test([encoding](const string& str) { return codepage::fits(encoding, string_view(str)); }, str8, fits);
+    }
+
+  return test_summary();
+}
@@ -7,7 +7,9 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <array>
 #include <cassert>
+#include <random>
 
 #include "test.h"
 
@@ -22,6 +24,8 @@ int main(void) {
   auto u16_to_u32 = [](u16string str){ u32string res; utf::decode(str, res); return res; };
   auto u32_to_u16 = [](u32string str){ u16string res; utf::encode(str, res); return res; };
   auto u32_to_u8 = [](u32string str){ string res; utf::encode(str, res); return res; };
+  auto u8_to_u16 = [](string str){ u16string res; utf::transcode(str, res); return res; };
+  auto u16_to_u8 = [](u16string str){ string res; utf::transcode(str, res); return res; };
 
   // Iterators
   auto u8_str_iter = [](string str) { decltype(str) res; for (auto&& chr : utf::decoder(str)) utf::append(res, chr); return res; };
@@ -67,5 +71,383 @@ int main(void) {
   test([=](u32string str) { return u16_to_u32(u16_str_iter(u32_to_u16(str))); }, u32, u32);
   test([=](u32string str) { return u16_to_u32(u16_cstr_iter(u32_to_u16(str))); }, u32, u32);
 
+  test(u8_to_u16, u8, u16);
+  test(u16_to_u8, u16, u8);
+
+  test([](string str) { return utf::last(string_view(str)); }, "a\xC3\xA9", char32_t(0xE9));
+  test([](string str) { return utf::last(string_view(str)); }, "a\xC3\xA9\xA9", char32_t('?'));
+  test([](u16string str) { return utf::last(u16string_view(str)); }, u"a\xD83D\xDE00", char32_t(0x1F600));
+
+  // Error policies
+  test([](string str) { u32string res; bool valid = utf::decode<utf::replace_fffd>(str, res); return valid ? U"" : res; }, "a\xFF\xE2\x82" "b", u32string(U"a\xFFFD\xFFFD" "b"));
+  test([](string str) { u32string res; utf::decode<utf::skip_errors>(str, res); return res; }, "a\xFF\xE2\x82" "b", u32string(U"ab"));
+  test([](string str) { u32string res; bool valid = utf::decode<utf::stop_on_error>(str, res); return valid ? U"" : res; }, "a\xFF\xE2\x82" "b", u32string(U"a"));
+  test([](string str) { u32string res; utf::decode<utf::pass_surrogates>(str, res); return res; }, "a\xFF\xE2\x82" "b", u32string(U"a\xDCFF\xDCE2\xDC82" "b"));
+  test([](u16string str) { u32string res; utf::decode<utf::pass_surrogates>(str, res); return res; }, u"a\xDC00\xD800" "b", u32string(U"a\xDC00\xD800" "b"));
+  test([](u32string str) { string res; bool valid = utf::encode<utf::replace_fffd>(str, res); return valid ? "" : res; }, U"a\x200000" "b", string("a\xEF\xBF\xBD" "b"));
+  test([](u32string str) { u16string res; utf::encode<utf::skip_errors>(str, res); return res; }, U"a\x110000" "b", u16string(u"ab"));
+  test([](string str) { u16string res; utf::transcode<utf::pass_surrogates>(str, res); return res; }, "a\xFF" "b", u16string(u"a\xDCFF" "b"));
+  test([](u16string str) { string res; utf::transcode<utf::pass_surrogates>(str, res); return res; }, u"a\xD800" "b", string("a\xED\xA0\x80" "b"));
+  test([](u16string str) { string res; utf::transcode<utf::stop_on_error>(str, res); return res; }, u"a\xD800" "b", string("a"));
+
+  // UTF-8 variants
+  test([](string str) { return utf::valid<utf::CESU8>(str); }, "\xED\xA0\xBD\xED\xB8\x80", true);
+  test([](string str) { return utf::valid<utf::CESU8>(str); }, "\xF0\x9F\x98\x80", false);
+  test([](string str) { return utf::valid<utf::CESU8>(str); }, "\xED\xA0\xBD", false);
+  test([](string str) { return utf::valid<utf::WTF8>(str); }, "\xED\xA0\xBD", true);
+  test([](string str) { return utf::valid<utf::WTF8>(str); }, "\xED\xA0\xBD\xED\xB8\x80", false);
+  test([](string str) { return utf::valid<utf::UTF8>(str); }, "\xED\xA0\xBD", false);
+  test([](string str) { return utf::valid<utf::MUTF8>(str); }, string("a\0", 2), false);
+  test([](string str) { return utf::valid<utf::MUTF8>(str); }, "a\xC0\x80", true);
+  test([](string str) { return utf::valid<utf::CESU8>(str); }, "a\xC0\x80", false);
+  test([](u32string str) { string res; utf::encode<utf::CESU8>(str, res); return res; }, U"a\U0001F600", string("a\xED\xA0\xBD\xED\xB8\x80"));
+  test([](u32string str) { string res; utf::encode<utf::MUTF8>(str, res); return res; }, u32string(U"a\0\U0001F600", 3), string("a\xC0\x80\xED\xA0\xBD\xED\xB8\x80"));
+  test([](u32string str) { string res; bool valid = utf::encode<utf::CESU8>(str, res); return valid ? "" : res; }, U"a\xD800", string("a?"));
+  test([](u32string str) { string res; bool valid = utf::encode<utf::WTF8>(str, res); return valid ? res : ""; }, U"a\xD800\xD83D\xDE00", string("a\xED\xA0\x80\xF0\x9F\x98\x80"));
+  test([](string str) { u32string res; utf::decode<utf::MUTF8>(str, res); return res; }, "a\xC0\x80\xED\xA0\xBD\xED\xB8\x80", u32string(U"a\0\U0001F600", 3));
+  test([](string str) { u32string res; bool valid = utf::decode<utf::MUTF8, utf::replace_fffd>(str, res); return valid ? U"" : res; }, string("a\0\xF0\x9F\x98\x80", 6), u32string(U"a\xFFFD\xFFFD"));
+  test([](string str) { u32string res; bool valid = utf::decode<utf::UTF8, utf::replace_fffd>(str, res); return valid ? U"" : res; }, "\xC0\xBF\xED\xA0\x80", u32string(U"\xFFFD\xFFFD"));
+  test([](u16string str) { string res; utf::transcode<utf::WTF8>(str, res); return res; }, u"a\xDC00\xD83D\xDE00\xD800", string("a\xED\xB0\x80\xF0\x9F\x98\x80\xED\xA0\x80"));
+  test([](string str) { u16string res; utf::transcode<utf::WTF8>(str, res); return res; }, "a\xED\xB0\x80\xF0\x9F\x98\x80\xED\xA0\x80", u16string(u"a\xDC00\xD83D\xDE00\xD800"));
+  test([](u16string str) { string res; utf::transcode<utf::MUTF8>(str, res); return res; }, u16string(u"a\0\xD83D\xDE00", 4), string("a\xC0\x80\xED\xA0\xBD\xED\xB8\x80"));
+  test([](string str) { string res; utf::recode<utf::MUTF8, utf::UTF8>(str, res); return res; }, "a\xC0\x80\xED\xA0\xBD\xED\xB8\x80", string("a\0\xF0\x9F\x98\x80", 6));
+  test([](string str) { string res; utf::recode<utf::UTF8, utf::MUTF8>(str, res); return res; }, string("a\0\xF0\x9F\x98\x80", 6), string("a\xC0\x80\xED\xA0\xBD\xED\xB8\x80"));
+  test([](string str) { string res; bool valid = utf::recode<utf::WTF8, utf::CESU8>(str, res); return valid ? "" : res; }, "a\xED\xA0\x80", string("a?"));
+
+  // Analysis, described as a string, and its reference computed from the
+  // validity, first invalid sequence, and results of whole-string methods.
+  auto describe = [](const utf::profile_t& profile) {
+    return to_string(profile.valid) + " " + to_string(profile.error_offset) + " " + to_string(profile.ascii) + " " +
+        to_string(profile.max_code_point) + " " + to_string(profile.utf8_length) + " " + to_string(profile.utf16_length) + " " + to_string(profile.utf32_length);
+  };
+  auto analyze = [&describe](auto str) { return describe(utf::analyze(str)); };
+  auto analyze_reference = [&](auto str) {
+    u32string decoded; string u8; u16string u16;
+    utf::decode(str, decoded); utf::encode(decoded, u8); utf::encode(decoded, u16);
+    bool valid = utf::valid(str), ascii = valid;
+    char32_t max_code_point = 0;
+    for (auto&& chr : decoded) ascii = ascii && chr < 0x80, max_code_point = max(max_code_point, chr);
+    vector<char32_t> buffer(str.size());
+    size_t error_offset = valid ? string_view::npos : utf::decode_into(str, buffer.data(), buffer.size()).consumed;
+    return describe({valid, error_offset, ascii, max_code_point, u8.size(), u16.size(), decoded.size()});
+  };
+  test(analyze, string_view("abc"), describe({true, string_view::npos, true, 'c', 3, 3, 3}));
+  test(analyze, string_view("a\xC3\xA9\xF0\x9F\x98\x80\xFF"), describe({false, 7, false, 0x1F600, 8, 5, 4}));
+  test(analyze, u16string_view(u"a\xE9\xD83D\xDE00"), describe({true, u16string_view::npos, false, 0x1F600, 7, 4, 3}));
+
+  // Conversion into buffers of random sizes, resumed while the output is full;
+  // returns the output, the final status, and the number of consumed units.
+  auto decode_into = [](auto... args) { return utf::decode_into(args...); };
+  auto encode_into = [](auto... args) { return utf::encode_into(args...); };
+  auto transcode_into = [](auto... args) { return utf::transcode_into(args...); };
+  auto into = [](auto convert, auto str, auto output, size_t size) {
+    vector<typename decltype(output)::value_type> buffer(size);
+    for (size_t consumed = 0; ; ) {
+      auto result = convert(str.substr(consumed), buffer.data(), buffer.size());
+      output.append(buffer.data(), result.written);
+      consumed += result.consumed;
+      if (result.status != utf::OUTPUT_FULL) return make_tuple(output, result.status, consumed);
+    }
+  };
+
+  // Incremental decoding of chunks of random sizes.
+  mt19937 generator(42);
+  auto stream = [&generator](auto str) {
+    utf::stream_decoder<typename decltype(str)::value_type> decoder;
+    u32string decoded;
+    for (size_t chunk; !str.empty(); str.remove_prefix(chunk))
+      decoder.feed(str.substr(0, chunk = min(str.size(), size_t(generator() % 2 ? generator() % 8 : generator() % 64))), decoded);
+    decoder.finish(decoded);
+    return decoded;
+  };
+
+  // Decoding with error policies, checked against decoding code point by code
+  // point, where errors are the replacements not decoded from a sequence
+  // which re-encodes to a (possibly overlong) '?' of the same length.
+  auto u8_to_u32_policy = [](string_view str, utf::error_action_t action) {
+    u32string res;
+    while (!str.empty()) {
+      string_view sequence = str;
+      char32_t chr = utf::decode(str);
+      sequence.remove_suffix(str.size());
+      bool overlong_question_mark = sequence.size() > 1 && ((unsigned)(unsigned char)sequence.front() >> (7 - sequence.size())) == (0xFFU >> (7 - sequence.size())) - 1;
+      if (chr != '?' || sequence == "?" || overlong_question_mark) res.push_back(chr);
+      else if (action == utf::REPLACE) res.push_back(0xFFFD);
+      else if (action == utf::STOP) break;
+      else if (action == utf::PASS_SURROGATES)
+        for (auto&& unit : sequence) res.push_back(0xDC00 + (unsigned char)unit);
+    }
+    return res;
+  };
+
+  // Backward decoding, removing the last code points or using reverse
+  // iterators, reversed back.
+  auto backward = [](auto str) { u32string res; while (!str.empty()) res.insert(res.begin(), utf::decode_last(str)); return res; };
+  auto reverse_iter = [](auto str) { u32string res; auto decoder = utf::decoder(str); for (auto it = decoder.rbegin(); it != decoder.rend(); it++) res.insert(res.begin(), *it); return res; };
+
+  // Decoding with offsets, checking that the sequences are contiguous and
+  // decode to the code points on their own.
+  auto with_offsets = [](auto str) {
+    u32string res;
+    size_t offset = 0;
+    for (auto&& decoded : utf::offsets(str)) {
+      auto sequence = str.substr(decoded.offset, decoded.length);
+      if (decoded.offset != offset || utf::decode(sequence) != decoded.codepoint || !sequence.empty()) return u32string(U"error");
+      res.push_back(decoded.codepoint);
+      offset += decoded.length;
+    }
+    return offset == str.size() ? res : u32string(U"error");
+  };
+
+  // Offset index conversions checked against the offsets of all code points,
+  // for random offsets and every pair of encodings.
+  auto index_conversions = [&generator](const string& str) {
+    vector<array<size_t, 3>> starts(1, {0, 0, 0});
+    for (auto&& decoded : utf::offsets(string_view(str)))
+      starts.push_back({decoded.offset + decoded.length, starts.back()[1] + (decoded.codepoint >= 0x10000 && decoded.codepoint <= 0x10FFFF ? 2 : 1), starts.back()[2] + 1});
+    utf::offset_index index(str, 1 + generator() % 10);
+    size_t (utf::offset_index::*conversions[3][3])(size_t) const = {
+      {nullptr, &utf::offset_index::utf8_to_utf16, &utf::offset_index::utf8_to_utf32},
+      {&utf::offset_index::utf16_to_utf8, nullptr, &utf::offset_index::utf16_to_utf32},
+      {&utf::offset_index::utf32_to_utf8, &utf::offset_index::utf32_to_utf16, nullptr}};
+    string errors;
+    for (int i = 0; i < 10; i++)
+      for (unsigned from = 0; from < 3; from++)
+        for (unsigned to = 0; to < 3; to++) if (from != to) {
+          size_t offset = generator() % (starts.back()[from] + 3), expected = 0;
+          for (auto&& start : starts) if (start[from] <= offset) expected = start[to];
+          if ((index.*conversions[from][to])(offset) != expected) errors += to_string(from) + "->" + to_string(to) + " ";
+        }
+    return errors;
+  };
+
+  // Boundaries and truncations at every offset and code point count, checked
+  // against the offsets of all code points.
+  auto boundaries = [](auto str) {
+    vector<size_t> starts;
+    for (auto&& decoded : utf::offsets(str)) starts.push_back(decoded.offset);
+    starts.push_back(str.size());
+    string errors;
+    for (size_t offset = 0, before = 0; offset <= str.size() + 1; offset++) {
+      while (before + 1 < starts.size() && starts[before + 1] <= offset) before++;
+      size_t after = starts[before] == offset || offset >= str.size() ? before : before + 1;
+      if (utf::boundary_before(str, offset) != starts[before]) errors += "before" + to_string(offset) + " ";
+      if (utf::boundary_after(str, offset) != starts[after]) errors += "after" + to_string(offset) + " ";
+      if (utf::truncate(str, offset).size() != starts[before]) errors += "truncate" + to_string(offset) + " ";
+    }
+    for (size_t code_points = 0; code_points <= starts.size(); code_points++)
+      if (utf::truncate_code_points(str, code_points).size() != starts[min(code_points, starts.size() - 1)])
+        errors += "truncate_code_points" + to_string(code_points) + " ";
+    return errors;
+  };
+
+  // Parallel conversions into the type of `converted` using small chunks,
+  // checked against the serial ones for all policies; the checks, and
+  // starting threads in them, are only occasional to keep the test fast.
+  auto parallel = [&generator](auto str, auto converted) {
+    string errors;
+    size_t chunk_size = 1 + generator() % 40;
+    utf::thread_executor executor(generator() % 100 ? 1 : 4);
+    auto check = [&](auto policy) {
+      using Policy = decltype(policy);
+      auto serial = converted;
+      bool serial_valid, parallel_valid;
+      if constexpr (is_same_v<decltype(converted), u32string>) {
+        serial_valid = utf::decode<Policy>(str, serial);
+        parallel_valid = utf::decode_parallel<Policy>(str, converted, chunk_size, executor);
+      } else if constexpr (is_same_v<decltype(str), u32string_view>) {
+        serial_valid = utf::encode<Policy>(str, serial);
+        parallel_valid = utf::encode_parallel<Policy>(str, converted, chunk_size, executor);
+      } else {
+        serial_valid = utf::transcode<Policy>(str, serial);
+        parallel_valid = utf::transcode_parallel<Policy>(str, converted, chunk_size, executor);
+      }
+      if (converted != serial || parallel_valid != serial_valid) errors += to_string(int(Policy::action)) + " ";
+    };
+    check(utf::replace_question_mark());
+    check(utf::replace_fffd());
+    check(utf::skip_errors());
+    check(utf::stop_on_error());
+    check(utf::pass_surrogates());
+    return errors;
+  };
+
+  // Validity of random UTF-8 buffers long enough to exercise the SIMD paths,
+  // checked against the scalar C-string implementation; strict validity is
+  // checked against decoding and encoding the buffer back. Bulk decoding is
+  // checked against decoding code point by code point.
+  vector<string> pieces = {"a", "?", "\xC0\xBF", "\xE0\x80\xBF", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "\xF4\x8F\xBF\xBF", string(40, 'x'),
+    "\xC0\x80", "\xC1\xBF", "\xE0\x9F\xBF", "\xF0\x8F\xBF\xBF", "\xED\xA0\x80", "\xED\xBF\xBF", "\xF4\x90\x80\x80", "\xF7\xBF\xBF\xBF", "\xED\xA0\xBD\xED\xB8\x80"};
+  auto u8_to_u32_scalar = [](string_view str) { u32string res; while (!str.empty()) res.push_back(utf::decode(str)); return res; };
+  auto strict_reference = [](const string& str) {
+    u32string decoded; string encoded;
+    utf::decode(string_view(str), decoded); utf::encode(decoded, encoded);
+    return utf::valid(str.c_str()) && utf::valid(decoded) && encoded == str;
+  };
+  // UTF-8 variants are checked by running the given tests for each of them;
+  // a string is valid if it decodes without errors and encodes back.
+  auto test_variants = [](auto tests) {
+    tests(integral_constant<utf::utf8_variant_t, utf::UTF8>());
+    tests(integral_constant<utf::utf8_variant_t, utf::CESU8>());
+    tests(integral_constant<utf::utf8_variant_t, utf::MUTF8>());
+    tests(integral_constant<utf::utf8_variant_t, utf::WTF8>());
+  };
+  auto variant_reference = [](const string& str, auto variant) {
+    u32string decoded; string encoded;
+    bool valid = utf::decode<variant, utf::stop_on_error>(str, decoded);
+    utf::encode<variant>(decoded, encoded);
+    return valid && encoded == str;
+  };
+  for (int i = 0; i < 100000; i++) {
+    string str;
+    for (size_t length = generator() % 300; str.size() < length; )
+      if (generator() % 8) str += pieces[generator() % pieces.size()];
+      else str += char(1 + generator() % 255);
+    if (generator() % 3 && !str.empty()) str.resize(generator() % str.size());
+    test([](const string& str) { return utf::valid(string_view(str)); }, str, utf::valid(str.c_str()));
+    test([](const string& str) { return utf::valid_strict(string_view(str)); }, str, strict_reference(str));
+    test([](const string& str) { return utf::valid_strict(str.c_str()); }, str, strict_reference(str));
+    test(u8_to_u32, str, u8_to_u32_scalar(str));
+    test(u8_to_u16, str, u32_to_u16(u8_to_u32(str)));
+    test([](const string& str) { return utf::valid<utf::UTF8>(str); }, str, strict_reference(str));
+    test_variants([&](auto variant) {
+      test([variant](const string& str) { return utf::valid<variant>(str); }, str, variant_reference(str, variant));
+      test([variant](const string& str) { string res; return utf::recode<variant, variant>(str, res) && res == str; }, str, variant_reference(str, variant));
+    });
+
+    auto decoded = u8_to_u32(str);
+    bool valid = utf::valid(str.c_str()), in_utf16_range = true;
+    for (auto&& chr : decoded) in_utf16_range = in_utf16_range && chr <= 0x10FFFF;
+    bool valid_utf16 = valid && in_utf16_range;
+    test([](const string& str) { return utf::utf32_length(str); }, str, decoded.size());
+    test([&stream](const string& str) { return stream(string_view(str)); }, str, decoded);
+    test(analyze, string_view(str), analyze_reference(string_view(str)));
+    test(index_conversions, str, string());
+    test([&boundaries](const string& str) { return boundaries(string_view(str)); }, str, string());
+    if (i % 4 == 0) {
+      test([&parallel](const string& str) { return parallel(string_view(str), u32string()); }, str, string());
+      test([&parallel](const string& str) { return parallel(string_view(str), u16string()); }, str, string());
+    }
+    test([&backward](const string& str) { return backward(string_view(str)); }, str, decoded);
+    test([&reverse_iter](const string& str) { return reverse_iter(string_view(str)); }, str, decoded);
+    test([&with_offsets](const string& str) { return with_offsets(string_view(str)); }, str, decoded);
+    test([](const string& str) { u32string res; utf::decode<utf::replace_fffd>(str, res); return res; }, str, u8_to_u32_policy(str, utf::REPLACE));
+    test([](const string& str) { u32string res; utf::decode<utf::skip_errors>(str, res); return res; }, str, u8_to_u32_policy(str, utf::SKIP));
+    test([](const string& str) { u32string res; utf::decode<utf::stop_on_error>(str, res); return res; }, str, u8_to_u32_policy(str, utf::STOP));
+    test([](const string& str) { u32string res; utf::decode<utf::pass_surrogates>(str, res); return res; }, str, u8_to_u32_policy(str, utf::PASS_SURROGATES));
+    test([](const string& str) { u32string res; return utf::decode<utf::skip_errors>(str, res); }, str, utf::valid(str.c_str()));
+    if (in_utf16_range)
+      test([](const string& str) { u16string res; utf::transcode<utf::pass_surrogates>(str, res); return res; }, str, u32_to_u16(u8_to_u32_policy(str, utf::PASS_SURROGATES)));
+    auto [decoded_into, decoded_status, decoded_consumed] = into(decode_into, string_view(str), u32string(), 4 + generator() % 40);
+    test(u8_to_u32, str.substr(0, decoded_consumed), decoded_into);
+    test([](utf::status_t status) { return status == utf::OK; }, decoded_status, valid);
+    auto [transcoded_into, transcoded_status, transcoded_consumed] = into(transcode_into, string_view(str), u16string(), 4 + generator() % 40);
+    test(u8_to_u16, str.substr(0, transcoded_consumed), transcoded_into);
+    test([](utf::status_t status) { return status == utf::OK; }, transcoded_status, valid_utf16);
+  }
+
+  // Encoding of random UTF-32 buffers, including code points outside of
+  // Unicode, checked against appending code point by code point.
+  auto u32_to_u8_scalar = [](const u32string& str) { string res; for (auto&& chr : str) utf::append(res, chr); return res; };
+  auto u32_to_u16_scalar = [](const u32string& str) { u16string res; for (auto&& chr : str) utf::append(res, chr); return res; };
+  auto variant_decoded = [](const u32string& str, utf::utf8_variant_t variant) {
+    u32string res;
+    for (size_t i = 0; i < str.size(); i++)
+      if (str[i] > 0x10FFFF || (str[i] >= 0xD800 && str[i] < 0xE000 && variant != utf::WTF8)) res += '?';
+      else if (variant == utf::WTF8 && str[i] >= 0xD800 && str[i] < 0xDC00 && i + 1 < str.size() && str[i + 1] >= 0xDC00 && str[i + 1] < 0xE000)
+        res += 0x10000 + ((str[i] - 0xD800) << 10) + (str[i + 1] - 0xDC00), i++;
+      else res += str[i];
+    return res;
+  };
+  auto u32_to_variant_scalar = [&variant_decoded](const u32string& str, utf::utf8_variant_t variant) {
+    string res;
+    for (auto&& chr : variant_decoded(str, variant))
+      if (variant == utf::MUTF8 && !chr) res += string("\xC0\x80");
+      else if ((variant == utf::CESU8 || variant == utf::MUTF8) && chr >= 0x10000)
+        utf::append(res, 0xD800 + ((chr - 0x10000) >> 10)), utf::append(res, 0xDC00 + ((chr - 0x10000) & 0x3FF));
+      else utf::append(res, chr);
+    return res;
+  };
+  auto u32_to_wtf16_scalar = [](const u32string& str) { u16string res; for (auto&& chr : str) if (chr >= 0xD800 && chr < 0xE000) res += chr; else utf::append(res, chr); return res; };
+  vector<char32_t> limits = {0x80, 0x800, 0x10000, 0x110000, 0x200000};
+  for (int i = 0; i < 100000; i++) {
+    u32string str;
+    for (size_t length = generator() % 300; str.size() < length; )
+      if (generator() % 2) str.append(generator() % 40, 'a' + generator() % 26);
+      else if (generator() % 8) str.push_back(generator() % limits[generator() % limits.size()]);
+      else str.push_back(generator());
+    test(u32_to_u8, str, u32_to_u8_scalar(str));
+    test(u32_to_u16, str, u32_to_u16_scalar(str));
+    u16string u16 = u32_to_u16_scalar(str);
+    test(u16_to_u8, u16, u32_to_u8(u16_to_u32(u16)));
+    test_variants([&](auto variant) {
+      string encoded = u32_to_variant_scalar(str, variant);
+      u32string decoded = variant_decoded(str, variant), u16_decoded;
+      bool valid = all_of(str.begin(), str.end(), [variant](char32_t chr) { return chr <= 0x10FFFF && (variant == utf::WTF8 || chr < 0xD800 || chr >= 0xE000); });
+      utf::decode<utf::pass_surrogates>(u16, u16_decoded);
+      test([variant](const u32string& str) { string res; utf::encode<variant>(str, res); return res; }, str, encoded);
+      test([variant](const u32string& str) { string res; return utf::encode<variant>(str, res); }, str, valid);
+      test([variant](const string& str) { u32string res; utf::decode<variant>(str, res); return res; }, encoded, decoded);
+      test([variant](const string& str) { u16string res; utf::transcode<variant>(str, res); return res; }, encoded, u32_to_wtf16_scalar(decoded));
+      test([variant](const u16string& str) { string res; utf::transcode<variant>(str, res); return res; }, u16, u32_to_variant_scalar(u16_decoded, variant));
+      test([variant](const string& str) { string res; utf::recode<utf::UTF8, variant>(str, res); return res; }, u32_to_u8(str), u32_to_variant_scalar(variant_decoded(str, utf::UTF8), variant));
+      test([variant](const string& str) { string res; utf::recode<variant, utf::UTF8>(str, res); return res; }, encoded, u32_to_variant_scalar(decoded, utf::UTF8));
+    });
+
+    size_t encodable_utf8 = 0, encodable_utf16 = 0;
+    while (encodable_utf8 < str.size() && str[encodable_utf8] < 0x200000) encodable_utf8++;
+    while (encodable_utf16 < str.size() && str[encodable_utf16] <= 0x10FFFF) encodable_utf16++;
+    auto [encoded8_into, encoded8_status, encoded8_consumed] = into(encode_into, u32string_view(str), string(), 4 + generator() % 40);
+    test(u32_to_u8, str.substr(0, encoded8_consumed), encoded8_into);
+    test([](size_t consumed) { return consumed; }, encoded8_consumed, encodable_utf8);
+    test([](utf::status_t status) { return status == utf::OK; }, encoded8_status, encodable_utf8 == str.size());
+    auto [encoded16_into, encoded16_status, encoded16_consumed] = into(encode_into, u32string_view(str), u16string(), 4 + generator() % 40);
+    test(u32_to_u16, str.substr(0, encoded16_consumed), encoded16_into);
+    test([](size_t consumed) { return consumed; }, encoded16_consumed, encodable_utf16);
+    test([](utf::status_t status) { return status == utf::OK; }, encoded16_status, encodable_utf16 == str.size());
+
+    test([](const u16string& str) { return utf::utf32_length(str); }, u16, u16_to_u32(u16).size());
+    test([&stream](const u16string& str) { return stream(u16string_view(str)); }, u16, u16_to_u32(u16));
+    test(analyze, u16string_view(u16), analyze_reference(u16string_view(u16)));
+    if (i % 4 == 0) {
+      test([&parallel](const u32string& str) { return parallel(u32string_view(str), string()); }, str, string());
+      test([&parallel](const u32string& str) { return parallel(u32string_view(str), u16string()); }, str, string());
+    }
+    auto [decoded_into, decoded_status, decoded_consumed] = into(decode_into, u16string_view(u16), u32string(), 4 + generator() % 40);
+    test(u16_to_u32, u16.substr(0, decoded_consumed), decoded_into);
+    test([](utf::status_t status) { return status == utf::OK; }, decoded_status, utf::valid(u16));
+    auto [transcoded_into, transcoded_status, transcoded_consumed] = into(transcode_into, u16string_view(u16), string(), 4 + generator() % 40);
+    test(u16_to_u8, u16.substr(0, transcoded_consumed), transcoded_into);
+    test([](utf::status_t status) { return status == utf::OK; }, transcoded_status, utf::valid(u16));
+  }
+
+  // Validity and decoding of random UTF-16 buffers with BMP runs and both
+  // paired and lone surrogates, checked against the scalar implementations.
+  auto u16_valid_scalar = [](const u16string& str) {
+    for (size_t i = 0; i < str.size(); i++)
+      if ((str[i] & 0xFC00) == 0xDC00 || ((str[i] & 0xFC00) == 0xD800 && (++i == str.size() || (str[i] & 0xFC00) != 0xDC00))) return false;
+    return true;
+  };
+  auto u16_to_u32_scalar = [](u16string_view str) { u32string res; while (!str.empty()) res.push_back(utf::decode(str)); return res; };
+  for (int i = 0; i < 100000; i++) {
+    u16string str;
+    for (size_t length = generator() % 300; str.size() < length; )
+      if (generator() % 2) str.append(generator() % 40, 0x100 + generator() % 0x100);
+      else if (generator() % 4) str.append({char16_t(0xD800 + generator() % 0x400), char16_t(0xDC00 + generator() % 0x400)});
+      else str.push_back(0xD800 + generator() % 0x800);
+    if (generator() % 3 && !str.empty()) str.resize(generator() % str.size());
+    test([](const u16string& str) { return utf::valid(u16string_view(str)); }, str, u16_valid_scalar(str));
+    test(u16_to_u32, str, u16_to_u32_scalar(str));
+    test([&backward](const u16string& str) { return backward(u16string_view(str)); }, str, u16_to_u32_scalar(str));
+    test([&reverse_iter](const u16string& str) { return reverse_iter(u16string_view(str)); }, str, u16_to_u32_scalar(str));
+    test([&with_offsets](const u16string& str) { return with_offsets(u16string_view(str)); }, str, u16_to_u32_scalar(str));
+    test([&boundaries](const u16string& str) { return boundaries(u16string_view(str)); }, str, string());
+    test([](const u16string& str) { string wtf8; utf::transcode<utf::WTF8>(str, wtf8); u16string res; return utf::valid<utf::WTF8>(wtf8) && utf::transcode<utf::WTF8>(wtf8, res) ? res : u16string(); }, str, str);
+    if (i % 4 == 0) {
+      test([&parallel](const u16string& str) { return parallel(u16string_view(str), u32string()); }, str, string());
+      test([&parallel](const u16string& str) { return parallel(u16string_view(str), string()); }, str, string());
+    }
+  }
+
   return test_summary();
 }
@@ -7,11 +7,31 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <cstdlib>
+#include <new>
+#include <random>
+
 #include "test.h"
 
 #include "uninorms.h"
+#include "utf.h"
 using namespace unilib;
 
+// Number of heap allocations, to check that normalizing large inputs
+// incrementally or in batches reuses its buffers. GCC would warn about
+// freeing memory from operator new once the delete below gets inlined.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+size_t allocations = 0;
+void* operator new(size_t size) {
+  allocations++;
+  if (void* ptr = malloc(size ? size : 1)) return ptr;
+  throw bad_alloc();
+}
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { free(ptr); }
+
 int main(void) {
   // Unicode normalization
   auto nfc = [](u32string str) { uninorms::nfc(str); return str; };
@@ -19,6 +39,54 @@ int main(void) {
   auto nfkc = [](u32string str) { uninorms::nfkc(str); return str; };
   auto nfkd = [](u32string str) { uninorms::nfkd(str); return str; };
 
+  // UTF-8 normalization, checked against decoding, normalizing, and encoding.
+  auto u8_nfc = [](const string& str) { string res; uninorms::nfc(str, res); return res; };
+  auto u8_nfd = [](const string& str) { string res; uninorms::nfd(str, res); return res; };
+  auto u8_nfkc = [](const string& str) { string res; uninorms::nfkc(str, res); return res; };
+  auto u8_nfkd = [](const string& str) { string res; uninorms::nfkd(str, res); return res; };
+  auto u8_reference = [](const string& str, auto normalize) { u32string decoded; string res; utf::decode(str, decoded); utf::encode(normalize(decoded), res); return res; };
+
+  // Parallel normalization in the given form, using the given executor.
+  auto parallel = [](uninorms::form_t form, u32string& str, size_t chunk_size, auto&& run) {
+    if (form == uninorms::NFC) uninorms::nfc_parallel(str, chunk_size, run);
+    if (form == uninorms::NFD) uninorms::nfd_parallel(str, chunk_size, run);
+    if (form == uninorms::NFKC) uninorms::nfkc_parallel(str, chunk_size, run);
+    if (form == uninorms::NFKD) uninorms::nfkd_parallel(str, chunk_size, run);
+  };
+  auto u8_parallel = [](uninorms::form_t form, const string& str, string& res, size_t chunk_size, auto&& run) {
+    if (form == uninorms::NFC) uninorms::nfc_parallel(str, res, chunk_size, run);
+    if (form == uninorms::NFD) uninorms::nfd_parallel(str, res, chunk_size, run);
+    if (form == uninorms::NFKC) uninorms::nfkc_parallel(str, res, chunk_size, run);
+    if (form == uninorms::NFKD) uninorms::nfkd_parallel(str, res, chunk_size, run);
+  };
+  // Batch normalization in the given form, returning the normalized strings
+  // each followed by a separator which is not a code point.
+  const char32_t separator = 0x110000;
+  auto batch = [separator](uninorms::form_t form, u32string_view strs, const vector<size_t>& offsets) {
+    u32string normalized, res;
+    vector<size_t> normalized_offsets;
+    if (form == uninorms::NFC) uninorms::nfc_batch(strs, offsets, normalized, normalized_offsets);
+    if (form == uninorms::NFD) uninorms::nfd_batch(strs, offsets, normalized, normalized_offsets);
+    if (form == uninorms::NFKC) uninorms::nfkc_batch(strs, offsets, normalized, normalized_offsets);
+    if (form == uninorms::NFKD) uninorms::nfkd_batch(strs, offsets, normalized, normalized_offsets);
+    for (size_t i = 0; i + 1 < normalized_offsets.size(); i++)
+      res.append(normalized, normalized_offsets[i], normalized_offsets[i + 1] - normalized_offsets[i]).push_back(separator);
+    return normalized_offsets.front() == 0 && normalized_offsets.back() == normalized.size() ? res : u32string();
+  };
+  auto serial = [](size_t tasks, const auto& task) { for (size_t i = 0; i < tasks; i++) task(i); };
+
+  // Quick check, which must agree with the normalization unless it returns
+  // MAYBE, and which must be exact for NFD and NFKD.
+  auto quick_check = [](u32string str, auto is_normalized, auto normalize) {
+    uninorms::quick_check_t result = is_normalized(str);
+    bool normalized = normalize(str) == str;
+    return result == uninorms::MAYBE || (result == uninorms::YES) == normalized;
+  };
+  auto is_nfc = [](u32string_view str) { return uninorms::is_nfc(str); };
+  auto is_nfd = [](u32string_view str) { return uninorms::is_nfd(str); };
+  auto is_nfkc = [](u32string_view str) { return uninorms::is_nfkc(str); };
+  auto is_nfkd = [](u32string_view str) { return uninorms::is_nfkd(str); };
+
   // Load UCD NormalizationTest from standard input and perform required
   // conformance tests.
   string line;
@@ -26,6 +94,8 @@ int main(void) {
   vector<string> characters;
   vector<u32string> forms(5);
   vector<bool> tested_chars(0x110000);
+  u32string all_forms;
+  string u8_all_forms;
   while (getline(cin, line)) {
     if (line.empty() || line.compare(0, 1, "#") == 0 || line.compare(0, 1, "@") == 0) continue;
 
@@ -63,9 +133,49 @@ int main(void) {
     test(nfkd, forms[3], forms[4]);
     test(nfkd, forms[4], forms[4]);
 
+    // Renormalization after a stable prefix.
+    u32string prefix(U"Normalized prefix ");
+    test(nfc, prefix + forms[0], prefix + forms[1]);
+    test(nfd, prefix + forms[0], prefix + forms[2]);
+    test(nfkc, prefix + forms[0], prefix + forms[3]);
+    test(nfkd, prefix + forms[0], prefix + forms[4]);
+
+    // UTF-8 normalization of the forms with normalized and invalid parts.
+    string u8_forms, u8_form;
+    for (auto&& form : forms) {
+      utf::encode(form, u8_form);
+      u8_forms.append(u8_form).append(line.size() % 2 ? "\xE0\x80" : " x\xCC\x81");
+    }
+    test(u8_nfc, u8_forms, u8_reference(u8_forms, nfc));
+    test(u8_nfd, u8_forms, u8_reference(u8_forms, nfd));
+    test(u8_nfkc, u8_forms, u8_reference(u8_forms, nfkc));
+    test(u8_nfkd, u8_forms, u8_reference(u8_forms, nfkd));
+
+    for (auto&& form : forms) {
+      test([&](const u32string& str) { return quick_check(str, is_nfc, nfc); }, form, true);
+      test([&](const u32string& str) { return quick_check(str, is_nfd, nfd); }, form, true);
+      test([&](const u32string& str) { return quick_check(str, is_nfkc, nfkc); }, form, true);
+      test([&](const u32string& str) { return quick_check(str, is_nfkd, nfkd); }, form, true);
+      test([&](const u32string& str) { return is_nfd(str) != uninorms::MAYBE && is_nfkd(str) != uninorms::MAYBE; }, form, true);
+    }
+    test([&](const u32string& str) { return is_nfc(str) != uninorms::NO; }, forms[1], true);
+    test(is_nfd, forms[2], uninorms::YES);
+    test([&](const u32string& str) { return is_nfkc(str) != uninorms::NO; }, forms[3], true);
+    test(is_nfkd, forms[4], uninorms::YES);
+
     if (forms[0].size() == 1) tested_chars[forms[0][0]] = true;
+    for (auto&& form : forms) all_forms.append(form);
+    u8_all_forms.append(u8_forms);
   }
 
+  // Parallel normalization of all the forms using small chunks.
+  for (size_t chunk_size : {1, 7, 1000})
+    for (auto form : {uninorms::NFC, uninorms::NFD, uninorms::NFKC, uninorms::NFKD}) {
+      auto normalize = form == uninorms::NFC ? nfc : form == uninorms::NFD ? nfd : form == uninorms::NFKC ? nfkc : nfkd;
+      test([&, form, chunk_size](u32string str) { parallel(form, str, chunk_size, utf::thread_executor(4)); return str; }, all_forms, normalize(all_forms));
+      test([&, form, chunk_size](const string& str) { string res; u8_parallel(form, str, res, chunk_size, utf::thread_executor(4)); return res; }, u8_all_forms, u8_reference(u8_all_forms, normalize));
+    }
+
   // One-letter strings not mentioned in NormalizationTest are fixed points.
   u32string letter(U" ");
   for (char32_t chr = 0; chr < tested_chars.size(); chr++)
@@ -75,7 +185,88 @@ int main(void) {
       test(nfd, letter, letter);
       test(nfkc, letter, letter);
       test(nfkd, letter, letter);
+      test(is_nfd, letter, uninorms::YES);
+      test(is_nfkd, letter, uninorms::YES);
+      test([&](const u32string& str) { return is_nfc(str) != uninorms::NO && is_nfkc(str) != uninorms::NO; }, letter, true);
+    }
+
+  // UTF-8 normalization of random strings of pieces needing normalization,
+  // not needing it, and invalid.
+  vector<string> pieces = {"a", "e\xCC\x81", "\xC3\xA9", "\xCC\x81", "\xCC\xA3", "\xE1\x84\x80", "\xE1\x85\xA1", "\xEA\xB0\x80",
+    "\xEF\xAC\x81", "\xC2\xBD", "\xE2\x84\xAB", "\xF0\x9D\x85\x9E", "?", "\xC0\xBF", "\xC0\x80", "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xFF", "\xE0\x80", string(20, 'x')};
+  mt19937 generator(42);
+  for (int i = 0; i < 100000; i++) {
+    string str;
+    for (size_t length = generator() % 60; str.size() < length; ) str += pieces[generator() % pieces.size()];
+    test(u8_nfc, str, u8_reference(str, nfc));
+    test(u8_nfd, str, u8_reference(str, nfd));
+    test(u8_nfkc, str, u8_reference(str, nfkc));
+    test(u8_nfkd, str, u8_reference(str, nfkd));
+
+    // Streaming normalization of the decoded string split into random chunks.
+    u32string decoded;
+    utf::decode(str, decoded);
+    for (auto form : {uninorms::NFC, uninorms::NFD, uninorms::NFKC, uninorms::NFKD}) {
+      uninorms::stream_normalizer normalizer(form);
+      u32string res;
+      for (size_t offset = 0, length; offset < decoded.size(); offset += length) {
+        length = generator() % 8;
+        normalizer.feed(u32string_view(decoded).substr(offset, length), res);
+      }
+      normalizer.finish(res);
+      auto normalize = form == uninorms::NFC ? nfc : form == uninorms::NFD ? nfd : form == uninorms::NFKC ? nfkc : nfkd;
+      test([](const u32string& res) { return res; }, res, normalize(decoded));
+
+      // Parallel normalization with random chunk sizes, run serially.
+      size_t chunk_size = generator() % 8;
+      test([&, form, chunk_size](u32string str) { parallel(form, str, chunk_size, serial); return str; }, decoded, normalize(decoded));
+      test([&, form, chunk_size](const string& str) { string res; u8_parallel(form, str, res, chunk_size, serial); return res; }, str, u8_reference(str, normalize));
+
+      // Batch normalization of the decoded string split into random strings,
+      // starting at a nonzero offset.
+      vector<size_t> offsets(1, generator() % (decoded.size() + 1));
+      u32string expected;
+      while (offsets.back() < decoded.size()) {
+        offsets.push_back(min(decoded.size(), offsets.back() + generator() % 8));
+        expected.append(normalize(decoded.substr(offsets[offsets.size() - 2], offsets.back() - offsets[offsets.size() - 2]))).push_back(separator);
+      }
+      test([&, form](const u32string& str) { return batch(form, str, offsets); }, decoded, expected);
     }
+  }
+
+  // Streaming normalization of a large input in chunks only renormalizes
+  // the output of the current chunk, so the output buffer grows
+  // geometrically and the scratch buffer is reused.
+  u32string large, large_nfc, streamed;
+  for (size_t i = 0; large.size() < (1 << 20); i++) large.append(i % 2 ? U"e\u0301 " : U"\u1EBF ");
+  large_nfc = nfc(large);
+  for (auto form : {uninorms::NFC, uninorms::NFD}) {
+    uninorms::stream_normalizer normalizer(form);
+    size_t allocations_before = allocations;
+    streamed.clear();
+    streamed.shrink_to_fit();
+    for (size_t offset = 0; offset < large.size(); offset += 4096)
+      normalizer.feed(u32string_view(large).substr(offset, 4096), streamed);
+    normalizer.finish(streamed);
+    test([](size_t allocations) { return allocations < 100; }, allocations - allocations_before, true);
+    test([](const u32string& res) { return res; }, streamed, form == uninorms::NFC ? large_nfc : nfd(large));
+  }
+
+  // Batch normalization renormalizes the strings failing the quick check in
+  // place, so the number of allocations does not grow with their number.
+  u32string tokens, tokens_nfkc, batched;
+  vector<size_t> token_offsets(1, 0), token_nfkc_offsets(1, 0), batched_offsets;
+  for (size_t i = 0; i < 100000; i++) {
+    tokens.append(U"Cafe\u0301");
+    token_offsets.push_back(tokens.size());
+    tokens_nfkc.append(U"Caf\u00E9");
+    token_nfkc_offsets.push_back(tokens_nfkc.size());
+  }
+  size_t allocations_before = allocations;
+  uninorms::nfkc_batch(tokens, token_offsets, batched, batched_offsets);
+  test([](size_t allocations) { return allocations < 100; }, allocations - allocations_before, true);
+  test([](const u32string& res) { return res; }, batched, tokens_nfkc);
+  test([&](const vector<size_t>& res) { return res == token_nfkc_offsets; }, batched_offsets, true);
 
   return test_summary();
 }
@@ -0,0 +1,131 @@
+// This file is part of UniLib <http://github.com/ufal/unilib/>.
+//
+// Copyright 2014 Institute of Formal and Applied Linguistics, Faculty of
+// Mathematics and Physics, Charles University in Prague, Czech Republic.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <random>
+
+#include "test.h"
+
+#include "unicode.h"
+#include "uninorms.h"
+#include "unistring.h"
+#include "utf.h"
+
+using namespace unilib;
+
+int main(void) {
+  auto width = [](const u32string& str) { return unsigned(unistring(str).width()); };
+  auto code_points = [](const unistring& str) { u32string res; for (size_t i = 0; i < str.size(); i++) res.push_back(str[i]); return res; };
+
+  // Storage width
+  test(width, u32string(), unsigned(unistring::LATIN1));
+  test(width, u32string(U"caf\u00E9"), unsigned(unistring::LATIN1));
+  test(width, u32string(U"\u20AC"), unsigned(unistring::UCS2));
+  test(width, u32string(U"\uFFFF"), unsigned(unistring::UCS2));
+  test(width, u32string(1, 0xD800), unsigned(unistring::UTF32));
+  test(width, u32string(U"a\U0001F600"), unsigned(unistring::UTF32));
+  test([](const string& str) { return unsigned(unistring(str).width()); }, string("caf\xC3\xA9"), unsigned(unistring::LATIN1));
+  test([](const string& str) { return unsigned(unistring(str).width()); }, string("\xE2\x82\xAC"), unsigned(unistring::UCS2));
+  test([](const string& str) { return unsigned(unistring(str).width()); }, string("\xED\xA0\x80"), unsigned(unistring::UTF32));
+  test([](const string& str) { return unsigned(unistring(str).width()); }, string("\xF0\x9F\x98\x80"), unsigned(unistring::UTF32));
+  test([](const u16string& str) { return unsigned(unistring(str).width()); }, u16string(u"\u00E9"), unsigned(unistring::LATIN1));
+  test([](const u16string& str) { return unsigned(unistring(str).width()); }, u16string(1, 0xDC00), unsigned(unistring::LATIN1));
+  test([](const u16string& str) { return unsigned(unistring(str).width()); }, u16string(u"\U0001F600"), unsigned(unistring::UTF32));
+
+  // Widening by modifications, and narrowing by compact
+  test([](const u32string& str) { unistring res(str); res.push_back(0x20AC); return unsigned(res.width()); }, u32string(U"abc"), unsigned(unistring::UCS2));
+  test([](const u32string& str) { unistring res(str); res.set(1, 0x1F600); return res.utf32(); }, u32string(U"abc"), u32string(U"a\U0001F600c"));
+  test([](const u32string& str) { unistring res(str); res.set(1, 'b'); return unsigned(res.width()); }, u32string(U"a\U0001F600c"), unsigned(unistring::UTF32));
+  test([](const u32string& str) { unistring res(str); res.set(1, 'b'); res.compact(); return unsigned(res.width()); }, u32string(U"a\U0001F600c"), unsigned(unistring::LATIN1));
+  test([](const u32string& str) { unistring res(str); res.set(1, 0x20AC); res.compact(); return unsigned(res.width()); }, u32string(U"a\U0001F600c"), unsigned(unistring::UCS2));
+  test([](const u32string& str) { unistring res(str); res.set(1, 0xE9); res.compact(); return unsigned(res.width()); }, u32string(U"a\u20ACc"), unsigned(unistring::LATIN1));
+  test([](const u32string& str) { unistring res(str); res.set(1, 0xE9); res.compact(); return res.utf32(); }, u32string(U"a\u20ACc"), u32string(U"a\u00E9c"));
+  test([](const u32string& str) { unistring res(str); res.replace(1, U"\u20AC"); return res.utf32(); }, u32string(U"abc"), u32string(U"a\u20AC"));
+  test([](const u32string& str) { unistring res(str); res.replace(1, U"\u20AC"); return unsigned(res.width()); }, u32string(U"abc"), unsigned(unistring::UCS2));
+  test([](const u32string& str) { unistring res(str); res.replace(2, U"d"); return unsigned(res.width()); }, u32string(U"a\u20ACc"), unsigned(unistring::UCS2));
+  test([](const u32string& str) { return unistring(str).utf32(2); }, u32string(U"a\u20ACc\U0001F600"), u32string(U"c\U0001F600"));
+
+  // Casing and normalization choosing the result width
+  test([](const u32string& str) { unistring res(str); unicode::uppercase_string(res); return unsigned(res.width()); }, u32string(U"\u00FF"), unsigned(unistring::UCS2));
+  test([](const u32string& str) { unistring res(str); unicode::lowercase_string(res); return unsigned(res.width()); }, u32string(U"\u0178"), unsigned(unistring::LATIN1));
+  test([](const u32string& str) { unistring res(str); uninorms::nfd(res); return unsigned(res.width()); }, u32string(U"caf\u00E9"), unsigned(unistring::UCS2));
+  test([](const u32string& str) { unistring res(str); uninorms::nfc(res); return unsigned(res.width()); }, u32string(U"cafe\u0301"), unsigned(unistring::LATIN1));
+  test([](const u32string& str) { unistring res(str); uninorms::nfkc(res); return res.utf32(); }, u32string(U"\u00BD\u00E9"), u32string(U"1\u20442\u00E9"));
+  test([](const u32string& str) { unistring res(str); uninorms::nfc(res); return res.utf32(); }, u32string(U"\u20ACcafe\u0301"), u32string(U"\u20ACcaf\u00E9"));
+  test([](const u32string& str) { unistring res(str); res.set(1, 'b'); uninorms::nfc(res); return unsigned(res.width()); }, u32string(U"a\U0001F600\u00E9"), unsigned(unistring::UTF32));
+  test([](const u32string& str) { unistring res(str); res.set(1, 'b'); uninorms::nfd(res); return unsigned(res.width()); }, u32string(U"a\U0001F600\u00E9"), unsigned(unistring::UCS2));
+
+  // Comparisons of different widths
+  test([](const u32string& str) { return unistring(str) == unistring(u32string(U"abc")); }, u32string(U"abc"), true);
+  test([](const u32string& str) { unistring res(str); res.push_back(0x20AC); res.set(3, 'd'); return res == unistring(u32string(U"abcd")); }, u32string(U"abc"), true);
+  test([](const u32string& str) { return unistring(str) < unistring(u32string(U"ab\u20AC")); }, u32string(U"abc"), true);
+  test([](const u32string& str) { return unistring(str) < unistring(u32string(U"ab")); }, u32string(U"ab\u20AC"), false);
+
+  // Random strings with code points of all widths, checked against the
+  // corresponding operations on UTF-32 strings.
+  mt19937 generator(42);
+  for (int i = 0; i < 30000; i++) {
+    u32string str;
+    char32_t limits[] = {0x80, 0x100, 0x800, 0x10000, 0x110000};
+    char32_t limit = limits[generator() % 5];
+    for (size_t length = generator() % 100; str.size() < length; )
+      str.push_back(generator() % (generator() % 4 ? 0x100 : limit));
+    string str8; utf::encode(str, str8);
+    u16string str16; utf::encode(str, str16);
+    u32string decoded8; utf::decode(str8, decoded8);
+    u32string decoded16; utf::decode(str16, decoded16);
+
+    unistring unistr(str);
+    test(code_points, unistr, str);
+    test([](const unistring& str) { return str.size(); }, unistr, str.size());
+    test([](const unistring& str) { return str.utf32(); }, unistr, str);
+    test([](const unistring& str) { return str.utf8(); }, unistr, str8);
+    test([](const unistring& str) { return str.utf16(); }, unistr, str16);
+    test([&](const string& str) { return unistring(str) == unistr; }, str8, decoded8 == str);
+    test([&](const string& str) { return unistring(str).utf32(); }, str8, decoded8);
+    test([&](const u16string& str) { return unistring(str).utf32(); }, str16, decoded16);
+
+    // Compact storage is the smallest sufficient width.
+    unsigned expected_width = unistring::LATIN1;
+    for (auto&& chr : str) expected_width = max(expected_width, unsigned(chr < 0x100 ? 1 : chr < 0x10000 && (chr < 0xD800 || chr >= 0xE000) ? 2 : 4));
+    test(width, str, expected_width);
+
+    // Building by push_back, and modifying by set.
+    test([&](const u32string& str) { unistring res; for (auto&& chr : str) res.push_back(chr); return res == unistr; }, str, true);
+    if (!str.empty()) {
+      size_t index = generator() % str.size();
+      char32_t chr = generator() % limit;
+      u32string modified = str; modified[index] = chr;
+      test([index, chr](unistring str) { str.set(index, chr); return str.utf32(); }, unistr, modified);
+      test([index, chr](unistring str) { str.set(index, chr); str.compact(); return str.width(); }, unistr, unistring(modified).width());
+    }
+
+    // Comparison agrees with comparing UTF-32 strings.
+    u32string other = str.substr(0, generator() % (str.size() + 1));
+    if (generator() % 2) other.push_back(generator() % limit);
+    test([&](const u32string& other) { return unistring(other) < unistr; }, other, other < str);
+    test([&](const u32string& other) { return unistring(other) == unistr; }, other, other == str);
+
+    // Casing and normalization agree with the UTF-32 versions.
+    u32string lowercased = str, uppercased = str;
+    for (auto&& chr : lowercased) chr = unicode::lowercase(chr);
+    for (auto&& chr : uppercased) chr = unicode::uppercase(chr);
+    test([](unistring str) { unicode::lowercase_string(str); return str.utf32(); }, unistr, lowercased);
+    test([](unistring str) { unicode::uppercase_string(str); return str.utf32(); }, unistr, uppercased);
+    test([](unistring str) { unicode::uppercase_string(str); return str.width(); }, unistr, unistring(uppercased).width());
+    u32string nfc = str, nfd = str, nfkc = str, nfkd = str;
+    uninorms::nfc(nfc); uninorms::nfd(nfd); uninorms::nfkc(nfkc); uninorms::nfkd(nfkd);
+    test([](unistring str) { uninorms::nfc(str); return str.utf32(); }, unistr, nfc);
+    test([](unistring str) { uninorms::nfd(str); return str.utf32(); }, unistr, nfd);
+    test([](unistring str) { uninorms::nfkc(str); return str.utf32(); }, unistr, nfkc);
+    test([](unistring str) { uninorms::nfkd(str); return str.utf32(); }, unistr, nfkd);
+    test([](unistring str) { uninorms::nfkd(str); return str.width(); }, unistr, unistring(nfkd).width());
+  }
+
+  return test_summary();
+}
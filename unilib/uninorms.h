@@ -12,15 +12,22 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <string>
+#include <string_view>
+#include <vector>
+
+#include "utf.h"
 
 namespace unilib {
 
+class unistring;
+
 // The `uninorms` class performs normalization to [Unicode Normalization
 // Forms](http://unicode.org/reports/tr15/). All normalization forms are
 // supported and the normalization is performed in-place on a `u32string`
-// representing a string of Unicode code points.
+// representing a string of Unicode code points, or on a `unistring`.
 class uninorms {
  public:
   // Convert given string to [Normalization Form C](http://unicode.org/reports/tr15/#Norm_Forms).
@@ -35,9 +42,129 @@ class uninorms {
   // Convert given string to [Normalization Form KD](http://unicode.org/reports/tr15/#Norm_Forms).
   static void nfkd(std::u32string& str);
 
+  // Normalization of a UTF-8 string, producing the same result as decoding
+  // it using `utf::decode`, normalizing, and encoding back using
+  // `utf::encode`. Only the segments around code points not passing the
+  // quick check (or invalid sequences) are decoded and renormalized; the rest
+  // is copied verbatim.
+  static void nfc(std::string_view str, std::string& normalized);
+  static void nfd(std::string_view str, std::string& normalized);
+  static void nfkc(std::string_view str, std::string& normalized);
+  static void nfkd(std::string_view str, std::string& normalized);
+
+  // [Quick check](http://unicode.org/reports/tr15/#Detecting_Normalization_Forms)
+  // whether given string is in the given normalization form, using the NF*_QC
+  // properties. `MAYBE` (returned only for NFC and NFKC) means that only
+  // normalizing the string can tell. The normalization methods use the quick
+  // check too, renormalizing only from the last stable code point before the
+  // first one not passing it, so strings already normalized are just scanned.
+  enum quick_check_t { YES, NO, MAYBE };
+  static quick_check_t is_nfc(std::u32string_view str);
+  static quick_check_t is_nfd(std::u32string_view str);
+  static quick_check_t is_nfkc(std::u32string_view str);
+  static quick_check_t is_nfkd(std::u32string_view str);
+
+  // Normalization of a `unistring`. The quick check is performed on the
+  // storage of any width, and a string passing it (for example any Latin-1
+  // string in NFC) is left unchanged without widening. Otherwise only the
+  // part from the last stable code point on is converted to UTF-32 and
+  // normalized, and the storage is widened only if the result needs it and
+  // narrowed to the smallest sufficient width afterwards.
+  static void nfc(unistring& str);
+  static void nfd(unistring& str);
+  static void nfkc(unistring& str);
+  static void nfkd(unistring& str);
+
+  // Incremental normalization of a string split into chunks (for example
+  // produced by `utf::stream_decoder`), appending the normalized code points
+  // to `normalized`. The input from its last stable code point on is kept
+  // until the next `feed`, so the memory is bounded by the longest sequence
+  // of code points which are not stable, and `finish` normalizes whatever is
+  // left, making the normalizer ready for another string. The result is the
+  // same as normalizing the whole string at once.
+  enum form_t { NFC, NFD, NFKC, NFKD };
+  class stream_normalizer {
+   public:
+    stream_normalizer(form_t form);
+    void feed(std::u32string_view chunk, std::u32string& normalized);
+    void finish(std::u32string& normalized);
+   private:
+    form_t form;
+    std::u32string pending, scratch;
+  };
+
+  // Batch normalization of many strings stored contiguously in `strs`, the
+  // i-th one being `strs.substr(offsets[i], offsets[i + 1] - offsets[i])`
+  // like in Arrow string arrays. The normalized strings are stored the same
+  // way in `normalized`, with `normalized_offsets` starting at zero. The
+  // strings passing the quick check are just copied, and the others are
+  // renormalized in place, through a scratch buffer shared by the whole batch.
+  static void nfc_batch(std::u32string_view strs, const std::vector<size_t>& offsets, std::u32string& normalized, std::vector<size_t>& normalized_offsets);
+  static void nfd_batch(std::u32string_view strs, const std::vector<size_t>& offsets, std::u32string& normalized, std::vector<size_t>& normalized_offsets);
+  static void nfkc_batch(std::u32string_view strs, const std::vector<size_t>& offsets, std::u32string& normalized, std::vector<size_t>& normalized_offsets);
+  static void nfkd_batch(std::u32string_view strs, const std::vector<size_t>& offsets, std::u32string& normalized, std::vector<size_t>& normalized_offsets);
+
+  // Parallel normalization of a whole string, producing the same result as
+  // the serial methods. The string is split into chunks of about
+  // `chunk_size` code points (or bytes) at stable code points, so that the
+  // chunks can be normalized independently; a chunk passing the quick check
+  // is not normalized at all. The normalized chunks are concatenated into an
+  // exactly sized result. The executor is the same as in the `utf` class.
+  template<class Executor = utf::thread_executor>
+  static void nfc_parallel(std::u32string& str, size_t chunk_size = 1 << 20, Executor&& run = Executor());
+  template<class Executor = utf::thread_executor>
+  static void nfd_parallel(std::u32string& str, size_t chunk_size = 1 << 20, Executor&& run = Executor());
+  template<class Executor = utf::thread_executor>
+  static void nfkc_parallel(std::u32string& str, size_t chunk_size = 1 << 20, Executor&& run = Executor());
+  template<class Executor = utf::thread_executor>
+  static void nfkd_parallel(std::u32string& str, size_t chunk_size = 1 << 20, Executor&& run = Executor());
+
+  template<class Executor = utf::thread_executor>
+  static void nfc_parallel(std::string_view str, std::string& normalized, size_t chunk_size = 1 << 20, Executor&& run = Executor());
+  template<class Executor = utf::thread_executor>
+  static void nfd_parallel(std::string_view str, std::string& normalized, size_t chunk_size = 1 << 20, Executor&& run = Executor());
+  template<class Executor = utf::thread_executor>
+  static void nfkc_parallel(std::string_view str, std::string& normalized, size_t chunk_size = 1 << 20, Executor&& run = Executor());
+  template<class Executor = utf::thread_executor>
+  static void nfkd_parallel(std::string_view str, std::string& normalized, size_t chunk_size = 1 << 20, Executor&& run = Executor());
+
  private:
-  static void compose(std::u32string& str);
-  static void decompose(std::u32string& str, bool kanonical);
+  template<class Executor>
+  static void normalize_parallel(std::u32string& str, form_t form, size_t chunk_size, Executor&& run);
+  template<class Executor>
+  static void normalize_parallel(std::string_view str, std::string& normalized, form_t form, size_t chunk_size, Executor&& run);
+
+  // Offsets of the chunks of about `chunk_size` code units starting at
+  // stable code points; the first one is zero and the last one `str.size()`.
+  static std::vector<size_t> stable_chunks(std::u32string_view str, form_t form, size_t chunk_size);
+  static std::vector<size_t> stable_chunks(std::string_view str, form_t form, size_t chunk_size);
+
+  // Combining class and quick check result of a code point below CHARS
+  inline static unsigned ccc(char32_t chr);
+  inline static quick_check_t quick_check(char32_t chr, form_t form);
+
+  static quick_check_t quick_check(std::u32string_view str, form_t form);
+  static size_t stable_prefix(std::u32string_view str, form_t form);
+  static size_t stable_prefix(const unistring& str, form_t form);
+  static size_t stable_prefix(std::string_view str, form_t form);
+  template<class String> static size_t stable_prefix_of(const String& str, form_t form);
+  static bool is_stable(char32_t chr, form_t form);
+  static void normalize(std::u32string& str, form_t form, size_t start = 0);
+  static void normalize(std::u32string& str, form_t form, size_t start, std::u32string& scratch);
+  // Decomposition and (for NFC and NFKC) composition of the string from the
+  // stable code point `start` on, without the quick check
+  static void renormalize(std::u32string& str, form_t form, size_t start, std::u32string& scratch);
+  static void normalize(std::string_view str, std::string& normalized, form_t form);
+  static void normalize(unistring& str, form_t form);
+  static void normalize_batch(std::u32string_view strs, const std::vector<size_t>& offsets, std::u32string& normalized, std::vector<size_t>& normalized_offsets, form_t form);
+  static bool decode_utf8(std::string_view str, char32_t& chr, size_t& length);
+
+  // Composition and decomposition of the string from `start` on, which must
+  // be zero or the offset of a stable code point. Only the decomposed rest of
+  // the string is written into `scratch`, whose capacity is reused.
+  static void compose(std::u32string& str, size_t start = 0);
+  static void decompose(std::u32string& str, bool kompatibility, size_t start, std::u32string& scratch);
+  static void canonical_order(std::u32string& str, size_t start, size_t end);
 
   inline static const char32_t CHARS = 0x110000;
 
@@ -50,13 +177,131 @@ class uninorms {
   static const uint8_t ccc_index[CHARS >> 8];
   static const uint8_t ccc_block[][256];
 
-  static const uint8_t composition_index[CHARS >> 8];
-  static const uint16_t composition_block[][257];
-  static const char32_t composition_data[];
+  // Composition of a starter and a second character (both code points), or
+  // zero, using a perfect hash of the pairs: the bucket of a pair selects a
+  // seed, which places every pair of the bucket into a distinct slot.
+  static char32_t composition(char32_t starter, char32_t second);
+  inline static const unsigned COMPOSITION_SLOT_BITS = 11, COMPOSITION_BUCKET_BITS = 9;
+  static const uint16_t composition_seeds[1 << COMPOSITION_BUCKET_BITS];
+  static const uint64_t composition_table[1 << COMPOSITION_SLOT_BITS];
 
+  // Full canonical and kompatibility decompositions: an entry is twice the
+  // offset of the decomposition in the data, plus one if the decomposition
+  // (or the character itself, if it has none) contains a combining mark; the
+  // length is given by the offset of the following entry.
   static const uint8_t decomposition_index[CHARS >> 8];
   static const uint16_t decomposition_block[][257];
   static const char32_t decomposition_data[];
+
+  static const uint8_t kompatibility_decomposition_index[CHARS >> 8];
+  static const uint16_t kompatibility_decomposition_block[][257];
+  static const char32_t kompatibility_decomposition_data[];
+
+  static const uint8_t quick_check_index[CHARS >> 8];
+  static const uint8_t quick_check_block[][256];
 };
 
+// Definitions
+template<class Executor>
+void uninorms::nfc_parallel(std::u32string& str, size_t chunk_size, Executor&& run) {
+  normalize_parallel(str, NFC, chunk_size, run);
+}
+
+template<class Executor>
+void uninorms::nfd_parallel(std::u32string& str, size_t chunk_size, Executor&& run) {
+  normalize_parallel(str, NFD, chunk_size, run);
+}
+
+template<class Executor>
+void uninorms::nfkc_parallel(std::u32string& str, size_t chunk_size, Executor&& run) {
+  normalize_parallel(str, NFKC, chunk_size, run);
+}
+
+template<class Executor>
+void uninorms::nfkd_parallel(std::u32string& str, size_t chunk_size, Executor&& run) {
+  normalize_parallel(str, NFKD, chunk_size, run);
+}
+
+template<class Executor>
+void uninorms::nfc_parallel(std::string_view str, std::string& normalized, size_t chunk_size, Executor&& run) {
+  normalize_parallel(str, normalized, NFC, chunk_size, run);
+}
+
+template<class Executor>
+void uninorms::nfd_parallel(std::string_view str, std::string& normalized, size_t chunk_size, Executor&& run) {
+  normalize_parallel(str, normalized, NFD, chunk_size, run);
+}
+
+template<class Executor>
+void uninorms::nfkc_parallel(std::string_view str, std::string& normalized, size_t chunk_size, Executor&& run) {
+  normalize_parallel(str, normalized, NFKC, chunk_size, run);
+}
+
+template<class Executor>
+void uninorms::nfkd_parallel(std::string_view str, std::string& normalized, size_t chunk_size, Executor&& run) {
+  normalize_parallel(str, normalized, NFKD, chunk_size, run);
+}
+
+template<class Executor>
+void uninorms::normalize_parallel(std::u32string& str, form_t form, size_t chunk_size, Executor&& run) {
+  std::vector<size_t> starts = stable_chunks(str, form, chunk_size);
+  size_t chunks = starts.size() - 1;
+
+  // Normalize the chunks not passing the quick check from their last stable
+  // code point before the first failure on; the prefix is kept as it is.
+  std::vector<size_t> stable(chunks), offsets(chunks + 1, 0);
+  std::vector<std::u32string> rests(chunks);
+  run(chunks, [&](size_t i) {
+    std::u32string_view chunk = std::u32string_view(str).substr(starts[i], starts[i + 1] - starts[i]);
+    stable[i] = stable_prefix(chunk, form);
+    if (stable[i] < chunk.size()) {
+      rests[i].assign(chunk.substr(stable[i]));
+      normalize(rests[i], form);
+    }
+    offsets[i + 1] = stable[i] + rests[i].size();
+  });
+
+  // Prefix-sum the lengths, and concatenate the chunks into the result.
+  bool changed = false;
+  for (size_t i = 0; i < chunks; i++) {
+    changed = changed || stable[i] < starts[i + 1] - starts[i];
+    offsets[i + 1] += offsets[i];
+  }
+  if (!changed) return;
+
+  std::u32string normalized(offsets[chunks], 0);
+  run(chunks, [&](size_t i) {
+    auto output = std::copy(str.begin() + starts[i], str.begin() + starts[i] + stable[i], normalized.begin() + offsets[i]);
+    std::copy(rests[i].begin(), rests[i].end(), output);
+  });
+  str.swap(normalized);
+}
+
+template<class Executor>
+void uninorms::normalize_parallel(std::string_view str, std::string& normalized, form_t form, size_t chunk_size, Executor&& run) {
+  std::vector<size_t> starts = stable_chunks(str, form, chunk_size);
+  size_t chunks = starts.size() - 1;
+
+  // Normalize the chunks not passing the quick check from their last stable
+  // code point before the first failure on; the prefix is copied verbatim.
+  std::vector<size_t> stable(chunks), offsets(chunks + 1, 0);
+  std::vector<std::string> rests(chunks);
+  run(chunks, [&](size_t i) {
+    std::string_view chunk = str.substr(starts[i], starts[i + 1] - starts[i]);
+    stable[i] = stable_prefix(chunk, form);
+    if (stable[i] < chunk.size()) normalize(chunk.substr(stable[i]), rests[i], form);
+    offsets[i + 1] = stable[i] + rests[i].size();
+  });
+  for (size_t i = 0; i < chunks; i++)
+    offsets[i + 1] += offsets[i];
+
+  // Concatenate the unchanged prefixes copied from the input and the
+  // normalized rests into the result.
+  normalized.resize(offsets[chunks]);
+  run(chunks, [&](size_t i) {
+    auto output = std::copy(str.begin() + starts[i], str.begin() + starts[i] + stable[i], normalized.begin() + offsets[i]);
+    std::copy(rests[i].begin(), rests[i].end(), output);
+  });
+}
+
 } // namespace unilib
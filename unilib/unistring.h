@@ -0,0 +1,298 @@
+// This file is part of UniLib <http://github.com/ufal/unilib/>.
+//
+// Copyright 2014-2024 Institute of Formal and Applied Linguistics, Faculty
+// of Mathematics and Physics, Charles University in Prague, Czech Republic.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// UniLib version: 4.2.1-dev
+// Unicode version: 17.0.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <variant>
+
+#include "codepage.h"
+#include "utf.h"
+
+namespace unilib {
+
+// The `unistring` class is a string of code points stored compactly using
+// one, two, or four bytes per code point, like Python strings (PEP 393).
+// A Latin-1 string uses one byte per code point, a string of other BMP code
+// points except for surrogates uses two bytes, and any other string four
+// bytes. The construction, conversion, and `transform` methods choose the
+// smallest sufficient width; `push_back` and `set` widen the storage when
+// needed, but never narrow it, which can be done explicitly by `compact`.
+// The code points are accessed in constant time regardless of the width.
+class unistring {
+ public:
+  enum width_t { LATIN1 = 1, UCS2 = 2, UTF32 = 4 };
+
+  // Construction from code points, or by decoding UTF-8 or UTF-16 like the
+  // whole-string methods of the `utf` class
+  unistring() = default;
+  inline explicit unistring(std::u32string_view str);
+  inline explicit unistring(std::string_view str);
+  inline explicit unistring(std::u16string_view str);
+
+  // Number of code points and the number of bytes used for every one of them
+  inline size_t size() const;
+  inline bool empty() const;
+  inline width_t width() const;
+
+  // Access to the code points, widening the storage if needed
+  inline char32_t operator[](size_t index) const;
+  inline void set(size_t index, char32_t chr);
+  inline void push_back(char32_t chr);
+
+  // Replacing the code points from `index` to the end by `str`, widening the
+  // storage if needed
+  inline void replace(size_t index, std::u32string_view str);
+
+  // Replacing every code point by the result of `function`, choosing the
+  // smallest sufficient width for the result
+  template<class Function> inline void transform(Function function);
+
+  // Narrowing the storage to the smallest sufficient width
+  inline void compact();
+
+  // Conversions to code points (of the part from `index` on), UTF-8, and UTF-16
+  inline std::u32string utf32(size_t index = 0) const;
+  inline std::string utf8() const;
+  inline std::u16string utf16() const;
+
+  // Comparison of the code points, regardless of the width
+  inline bool operator==(const unistring& other) const;
+  inline bool operator!=(const unistring& other) const;
+  inline bool operator<(const unistring& other) const;
+
+ private:
+  inline static width_t width_of(char32_t chr);
+  inline void assign(std::u32string_view str, width_t width);
+  inline void widen(width_t width);
+  inline void narrow(width_t width);
+
+  std::variant<std::string, std::u16string, std::u32string> storage;
+};
+
+// Definitions
+unistring::unistring(std::u32string_view str) {
+  width_t width = LATIN1;
+  for (auto&& chr : str) width = std::max(width, width_of(chr));
+  assign(str, width);
+}
+
+unistring::unistring(std::string_view str) {
+  utf::profile_t profile = utf::analyze(str);
+  if (profile.max_code_point < 0x100) {
+    std::string latin1;
+    codepage::encode(codepage::LATIN1, str, latin1);
+    storage = std::move(latin1);
+    return;
+  }
+  if (profile.max_code_point < 0x10000) {
+    std::u16string ucs2;
+    utf::transcode(str, ucs2);
+    if (std::none_of(ucs2.begin(), ucs2.end(), [](char16_t chr) { return chr >= 0xD800 && chr < 0xE000; })) {
+      storage = std::move(ucs2);
+      return;
+    }
+  }
+
+  // Supplementary code points and surrogates encoded in UTF-8 need the full width.
+  std::u32string decoded;
+  utf::decode(str, decoded);
+  storage = std::move(decoded);
+}
+
+unistring::unistring(std::u16string_view str) {
+  utf::profile_t profile = utf::analyze(str);
+  if (profile.max_code_point < 0x100) {
+    std::string latin1;
+    codepage::encode(codepage::LATIN1, str, latin1);
+    storage = std::move(latin1);
+  } else if (profile.valid && profile.max_code_point < 0x10000) {
+    // Valid UTF-16 without supplementary code points has no surrogates.
+    storage = std::u16string(str);
+  } else {
+    std::u32string decoded;
+    utf::decode(str, decoded);
+    *this = unistring(std::u32string_view(decoded));
+  }
+}
+
+size_t unistring::size() const {
+  return std::visit([](const auto& str) { return str.size(); }, storage);
+}
+
+bool unistring::empty() const {
+  return !size();
+}
+
+unistring::width_t unistring::width() const {
+  return width_t(1 << storage.index());
+}
+
+char32_t unistring::operator[](size_t index) const {
+  switch (storage.index()) {
+    case 0: return (unsigned char)std::get<0>(storage)[index];
+    case 1: return std::get<1>(storage)[index];
+    default: return std::get<2>(storage)[index];
+  }
+}
+
+void unistring::set(size_t index, char32_t chr) {
+  if (width_of(chr) > width()) widen(width_of(chr));
+  switch (storage.index()) {
+    case 0: std::get<0>(storage)[index] = chr; break;
+    case 1: std::get<1>(storage)[index] = chr; break;
+    default: std::get<2>(storage)[index] = chr;
+  }
+}
+
+void unistring::push_back(char32_t chr) {
+  if (width_of(chr) > width()) widen(width_of(chr));
+  switch (storage.index()) {
+    case 0: std::get<0>(storage).push_back(chr); break;
+    case 1: std::get<1>(storage).push_back(chr); break;
+    default: std::get<2>(storage).push_back(chr);
+  }
+}
+
+void unistring::replace(size_t index, std::u32string_view str) {
+  width_t result_width = width();
+  for (auto&& chr : str) result_width = std::max(result_width, width_of(chr));
+  if (result_width > width()) widen(result_width);
+  switch (storage.index()) {
+    case 0: {
+      std::string latin1;
+      codepage::encode(codepage::LATIN1, str, latin1);
+      std::get<0>(storage).replace(index, std::string::npos, latin1);
+      break;
+    }
+    case 1: {
+      std::u16string ucs2;
+      utf::encode(str, ucs2);
+      std::get<1>(storage).replace(index, std::u16string::npos, ucs2);
+      break;
+    }
+    default: std::get<2>(storage).replace(index, std::u32string::npos, str);
+  }
+}
+
+template<class Function>
+void unistring::transform(Function function) {
+  width_t result_width = LATIN1;
+  for (size_t i = 0, length = size(); i < length; i++) {
+    char32_t chr = function((*this)[i]);
+    result_width = std::max(result_width, width_of(chr));
+    set(i, chr);
+  }
+  if (result_width < width()) narrow(result_width);
+}
+
+void unistring::compact() {
+  width_t result_width = LATIN1;
+  for (size_t i = 0, length = size(); i < length && result_width < width(); i++)
+    result_width = std::max(result_width, width_of((*this)[i]));
+  if (result_width < width()) narrow(result_width);
+}
+
+std::u32string unistring::utf32(size_t index) const {
+  std::u32string result;
+  switch (storage.index()) {
+    case 0: codepage::decode(codepage::LATIN1, std::string_view(std::get<0>(storage)).substr(index), result); break;
+    case 1: utf::decode(std::u16string_view(std::get<1>(storage)).substr(index), result); break;
+    default: result = std::get<2>(storage).substr(index);
+  }
+  return result;
+}
+
+std::string unistring::utf8() const {
+  std::string result;
+  switch (storage.index()) {
+    case 0: codepage::decode(codepage::LATIN1, std::get<0>(storage), result); break;
+    case 1: utf::transcode(std::u16string_view(std::get<1>(storage)), result); break;
+    default: utf::encode(std::u32string_view(std::get<2>(storage)), result);
+  }
+  return result;
+}
+
+std::u16string unistring::utf16() const {
+  std::u16string result;
+  switch (storage.index()) {
+    case 0: codepage::decode(codepage::LATIN1, std::get<0>(storage), result); break;
+    case 1: result = std::get<1>(storage); break;
+    default: utf::encode(std::u32string_view(std::get<2>(storage)), result);
+  }
+  return result;
+}
+
+bool unistring::operator==(const unistring& other) const {
+  if (storage.index() == other.storage.index()) return storage == other.storage;
+  if (size() != other.size()) return false;
+  for (size_t i = 0; i < size(); i++)
+    if ((*this)[i] != other[i]) return false;
+  return true;
+}
+
+bool unistring::operator!=(const unistring& other) const {
+  return !(*this == other);
+}
+
+bool unistring::operator<(const unistring& other) const {
+  // The strings of all widths are compared as unsigned code units.
+  if (storage.index() == other.storage.index()) return storage < other.storage;
+  for (size_t i = 0; i < size() && i < other.size(); i++)
+    if ((*this)[i] != other[i]) return (*this)[i] < other[i];
+  return size() < other.size();
+}
+
+unistring::width_t unistring::width_of(char32_t chr) {
+  return chr < 0x100 ? LATIN1 : chr < 0xD800 || (chr >= 0xE000 && chr < 0x10000) ? UCS2 : UTF32;
+}
+
+void unistring::assign(std::u32string_view str, width_t width) {
+  if (width == LATIN1) {
+    std::string latin1;
+    codepage::encode(codepage::LATIN1, str, latin1);
+    storage = std::move(latin1);
+  } else if (width == UCS2) {
+    std::u16string ucs2;
+    utf::encode(str, ucs2);
+    storage = std::move(ucs2);
+  } else {
+    storage = std::u32string(str);
+  }
+}
+
+void unistring::widen(width_t width) {
+  if (width == UCS2) {
+    std::u16string ucs2;
+    codepage::decode(codepage::LATIN1, std::get<0>(storage), ucs2);
+    storage = std::move(ucs2);
+  } else {
+    storage = utf32();
+  }
+}
+
+void unistring::narrow(width_t width) {
+  // The narrower storage is encoded directly from the current one.
+  if (storage.index() == 1) {
+    std::string latin1;
+    codepage::encode(codepage::LATIN1, std::u16string_view(std::get<1>(storage)), latin1);
+    storage = std::move(latin1);
+  } else {
+    assign(std::get<2>(storage), width);
+  }
+}
+
+} // namespace unilib